@@ -0,0 +1,207 @@
+#ifndef TL_CONTAINERS_COW_SHARED_ARRAY_HPP
+#define TL_CONTAINERS_COW_SHARED_ARRAY_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator
+#include <type_traits>		// std::remove_const_t
+#include <utility>			// std::move, std::swap
+
+#include <tl/containers/shared_array.hpp>		// tl::containers::shared_array
+
+
+namespace tl::containers {
+
+	/* Manages an array which is shared between copies with copy-on-write semantics.
+		Copying a cow_shared_array shares ownership of the array, as with shared_array. Any non-const access to the elements (through the
+		non-const overloads of operator[], begin(), end() and data()) first ensures this object is the only one sharing the array, by copying the
+		array if it is shared. Thus modifications are never visible through other cow_shared_array objects, while unmodified copies cost nothing.
+		References, pointers and iterators obtained through non-const access must not be used after this object is copied, as they would then
+		refer to the shared array.
+		If AtomicRefCount is true, distinct cow_shared_array objects sharing an array may be used from different threads. */
+	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
+	class cow_shared_array {
+	public:
+		/* Member types */
+
+		using array_type = shared_array<T, AtomicRefCount, Allocator, Alignment>;
+		using value_type = typename array_type::value_type;
+		using allocator_type = typename array_type::allocator_type;
+		using size_type = typename array_type::size_type;
+		using reference = typename array_type::reference;
+		using const_reference = typename array_type::const_reference;
+		using pointer = typename array_type::pointer;
+		using const_pointer = typename array_type::const_pointer;
+		using iterator = typename array_type::iterator;
+		using const_iterator = typename array_type::const_iterator;
+
+
+		/* Special members */
+
+		// If this is the last object sharing the array, the array is destroyed.
+		~cow_shared_array() = default;
+
+		// Constructs to have no array and default constructs the allocator.
+		cow_shared_array() :
+			_array()
+		{}
+
+		// Constructs to share ownership of other's array.
+		cow_shared_array(cow_shared_array const& other) = default;
+
+		// Transfers other's array ownership to this.
+		cow_shared_array(cow_shared_array&& other) :
+			cow_shared_array()
+		{
+			swap(*this, other);
+		}
+
+		// Constructs an array of the given size with default-constructed elements, using the given allocator.
+		explicit cow_shared_array(size_type size, Allocator alloc = Allocator()) :
+			_array(size, alloc)
+		{}
+
+		// Constructs an array of the given size with elements copy-constructed from value, using the given allocator.
+		cow_shared_array(size_type size, T const& value, Allocator alloc = Allocator()) :
+			_array(size, value, alloc)
+		{}
+
+		/* Constructs to share ownership of the given shared_array's array.
+			The array is copied on first non-const access if it is still shared by any shared_array or cow_shared_array objects. */
+		explicit cow_shared_array(array_type array) :
+			_array(std::move(array))
+		{}
+
+
+		/* Operators */
+
+		// Releases ownership of current array and shares ownership of rhs's array.
+		cow_shared_array& operator=(cow_shared_array rhs)
+		{
+			swap(*this, rhs);
+
+			return *this;
+		}
+
+		// Copies the array if it is shared, then gets a reference to the element at the given index.
+		reference operator[](size_type i)
+		{
+			_detach();
+
+			return _array[i];
+		}
+
+		// Gets a const reference to the element at the given index.
+		const_reference operator[](size_type i) const
+		{
+			return _array[i];
+		}
+
+
+		/* General functions */
+
+		// Copies the array if it is shared, then gets an iterator to the start of the array.
+		iterator begin()
+		{
+			_detach();
+
+			return _array.begin();
+		}
+
+		// Gets a const iterator to the start of the array.
+		const_iterator begin() const
+		{
+			return _array.cbegin();
+		}
+
+		// Gets a const iterator to the start of the array.
+		const_iterator cbegin() const
+		{
+			return _array.cbegin();
+		}
+
+		// Gets a const iterator to the end of the array.
+		const_iterator cend() const
+		{
+			return _array.cend();
+		}
+
+		// Copies the array if it is shared, then gets a pointer to the start of the array.
+		pointer data()
+		{
+			_detach();
+
+			return _array.data();
+		}
+
+		// Gets a const pointer to the start of the array.
+		const_pointer data() const
+		{
+			return _array.data();
+		}
+
+		// Copies the array if it is shared, then gets an iterator to the end of the array.
+		iterator end()
+		{
+			_detach();
+
+			return _array.end();
+		}
+
+		// Gets a const iterator to the end of the array.
+		const_iterator end() const
+		{
+			return _array.cend();
+		}
+
+		// Gets the number of elements in the array.
+		size_type size() const
+		{
+			return _array.size();
+		}
+
+		// Returns true if this is the only object sharing the array (ie. non-const access will not copy the array), otherwise false.
+		bool unique() const
+		{
+			return _array.unique();
+		}
+
+		// Gets the number of shared_array and cow_shared_array objects sharing the array, or 0 if there is no array.
+		size_type use_count() const
+		{
+			return _array.use_count();
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(cow_shared_array& first, cow_shared_array& second)
+		{
+			using std::swap;
+
+			swap(first._array, second._array);
+		}
+
+
+	private:
+		/* General functions */
+
+		// If the array is shared with any other objects, replaces it with a copy which is owned only by this object.
+		void _detach()
+		{
+			if (_array.use_count() > 1) {
+				_array = array_type(_array.cbegin(), _array.cend(), _array.get_allocator());
+			}
+		}
+
+
+		/* Variables */
+
+		array_type _array;
+	};
+
+}
+
+
+#endif
@@ -0,0 +1,242 @@
+#ifndef TL_CONTAINERS_LOCAL_SHARED_ARRAY_HPP
+#define TL_CONTAINERS_LOCAL_SHARED_ARRAY_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator, std::allocator_traits
+#include <type_traits>		// std::remove_const_t
+#include <utility>			// std::move, std::swap
+
+#include <tl/containers/shared_array.hpp>				// tl::containers::shared_array
+#include <tl/memory/allocate_construct.hpp>			// tl::memory::allocate_construct
+#include <tl/memory/destroy_deallocate.hpp>			// tl::memory::destroy_deallocate
+
+
+namespace tl::containers {
+
+	namespace detail {
+
+		// Stores the thread-local state for local_shared_array.
+		template<class Array>
+		struct local_shared_array_state {
+			// Number of local_shared_array objects currently sharing the local state.
+			std::size_t refs;
+
+			// The single shared_array reference held on behalf of all local_shared_array objects sharing this state.
+			Array array;
+		};
+
+	}
+
+
+	/* Shares ownership of an array managed by shared_array, using a non-atomic reference count for copies made within a single thread.
+		All local_shared_array objects copied from one another share a single local reference count, which together hold one reference to the
+		array's atomic reference count. Copying and destroying local_shared_array objects therefore only performs cheap non-atomic operations,
+		and the atomic reference count is only modified when the first local_shared_array is created from a shared_array and when the last one
+		is destroyed.
+		A local_shared_array and its copies must only be used by the thread which created them. To share the array with another thread, obtain a
+		shared_array through array(), which increments the atomic reference count.
+		The local state is a small object allocated with Allocator when a local_shared_array is created from a shared_array. To avoid the
+		general-purpose allocator for it, tl::memory::pool_allocator may be used. */
+	template<typename T, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
+	class local_shared_array {
+	public:
+		/* Member types */
+
+		using array_type = shared_array<T, true, Allocator, Alignment>;
+		using value_type = typename array_type::value_type;
+		using allocator_type = Allocator;
+		using size_type = typename array_type::size_type;
+		using reference = typename array_type::reference;
+		using const_reference = typename array_type::const_reference;
+		using pointer = typename array_type::pointer;
+		using const_pointer = typename array_type::const_pointer;
+		using iterator = typename array_type::iterator;
+		using const_iterator = typename array_type::const_iterator;
+
+
+		/* Special members */
+
+		/* If this is the last local_shared_array object sharing the local state, the local state is destroyed, releasing its reference to the
+			array. Destructs allocator. */
+		~local_shared_array()
+		{
+			if (_state && --_state->refs == 0) {
+				_state_alloc_t state_alloc(_alloc);
+				memory::destroy_deallocate(state_alloc, _state);
+			}
+		}
+
+		// Constructs to have no array and default constructs the allocator.
+		local_shared_array() :
+			_alloc(),
+			_state(),
+			_data(),
+			_size()
+		{}
+
+		// Constructs to share the local state of other (without modifying the array's atomic reference count), and copy-constructs allocator from other.
+		local_shared_array(local_shared_array const& other) :
+			_alloc(other._alloc),
+			_state(other._state),
+			_data(other._data),
+			_size(other._size)
+		{
+			if (_state) {
+				++_state->refs;
+			}
+		}
+
+		// Transfers other's local state to this, and move-constructs allocator from other.
+		local_shared_array(local_shared_array&& other) :
+			local_shared_array()
+		{
+			swap(*this, other);
+		}
+
+		// Creates a new local state holding the given shared_array's reference to its array, and constructs the allocator from the given value.
+		explicit local_shared_array(array_type array, Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(),
+			_data(array.data()),
+			_size(array.size())
+		{
+			if (_data) {
+				_state_alloc_t state_alloc(_alloc);
+				_state = memory::allocate_construct(state_alloc, _state_t{1, std::move(array)});
+			}
+		}
+
+
+		/* Operators */
+
+		// Releases the current local state, shares the local state of rhs, and copy/move-assigns allocator from rhs.
+		local_shared_array& operator=(local_shared_array rhs)
+		{
+			swap(*this, rhs);
+
+			return *this;
+		}
+
+		// Gets a reference to the element at the given index.
+		reference operator[](size_type i)
+		{
+			return _data[i];
+		}
+
+		// Gets a const reference to the element at the given index.
+		const_reference operator[](size_type i) const
+		{
+			return _data[i];
+		}
+
+
+		/* General functions */
+
+		/* Gets a shared_array which shares ownership of the array, which may be used from any thread.
+			This increments the array's atomic reference count. */
+		array_type array() const
+		{
+			return _state ? _state->array : array_type();
+		}
+
+		// Gets an iterator to the start of the array.
+		iterator begin()
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the start of the array.
+		iterator begin() const
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the start of the array.
+		iterator cbegin() const
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the end of the array.
+		iterator cend() const
+		{
+			return _data + _size;
+		}
+
+		// Gets a pointer to the start of the array.
+		pointer data()
+		{
+			return _data;
+		}
+
+		// Gets a const pointer to the start of the array.
+		const_pointer data() const
+		{
+			return _data;
+		}
+
+		// Gets an iterator to the end of the array.
+		iterator end()
+		{
+			return _data + _size;
+		}
+
+		// Gets a const iterator to the end of the array.
+		iterator end() const
+		{
+			return _data + _size;
+		}
+
+		// Gets the number of elements in the array.
+		size_type size() const
+		{
+			return _size;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(local_shared_array& first, local_shared_array& second)
+		{
+			using std::swap;
+
+			swap(first._alloc, second._alloc);
+			swap(first._state, second._state);
+			swap(first._data, second._data);
+			swap(first._size, second._size);
+		}
+
+
+	private:
+		/* Member types */
+
+		using _state_t = detail::local_shared_array_state<array_type>;
+
+		// Allocator type to be used for allocation of the local state object.
+		using _state_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<_state_t>;
+
+		using _state_pointer = typename std::allocator_traits<_state_alloc_t>::pointer;
+
+
+		/* Variables */
+
+		/* Allocator to use for allocation of the local state.
+			Mutable because const-qualified allocators aren't required to be useful. */
+		mutable Allocator _alloc;
+
+		// Pointer to the local state.
+		_state_pointer _state;
+
+		// Pointer to the first element of the array.
+		pointer _data;
+
+		// Number of elements in the array.
+		size_type _size;
+	};
+
+}
+
+
+#endif
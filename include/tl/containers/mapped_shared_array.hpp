@@ -0,0 +1,122 @@
+#ifndef TL_CONTAINERS_MAPPED_SHARED_ARRAY_HPP
+#define TL_CONTAINERS_MAPPED_SHARED_ARRAY_HPP
+
+
+#include <cerrno>				// errno
+#include <cstddef>				// std::size_t
+#include <system_error>			// std::generic_category, std::system_error
+#include <type_traits>			// std::is_trivially_copyable_v
+
+#include <fcntl.h>				// open, O_RDONLY
+#include <sys/mman.h>			// madvise, mmap, munmap, MADV_*, MAP_FAILED, MAP_PRIVATE, MAP_SHARED, PROT_READ, PROT_WRITE
+#include <sys/stat.h>			// fstat, struct stat
+#include <unistd.h>				// close
+
+#include <tl/containers/shared_array.hpp>		// tl::containers::shared_array
+
+
+namespace tl::containers {
+
+	// Hint to the operating system about how a memory-mapped file will be accessed.
+	enum class map_access {
+		// No particular access pattern.
+		normal,
+		// Pages will be accessed in order, so may be read ahead aggressively and freed soon after access (MADV_SEQUENTIAL).
+		sequential,
+		// Pages will be accessed in random order, so read ahead is not useful (MADV_RANDOM).
+		random
+	};
+
+
+	namespace detail {
+
+		// Unmaps a memory-mapped file. Used as the release function of a shared_array in external storage.
+		inline void unmap_file(void* storage, std::size_t storage_bytes)
+		{
+			::munmap(storage, storage_bytes);
+		}
+
+
+		/* Maps the file at the given path into memory with the given protection and flags, and returns a shared_array which owns the mapping.
+			Throws std::system_error on failure. */
+		template<typename T, typename U, bool AtomicRefCount>
+		shared_array<T, AtomicRefCount> map_file(char const* path, int protection, int flags, map_access access, bool prefetch)
+		{
+			static_assert(std::is_trivially_copyable_v<U>, "Only arrays of trivially copyable types can be mapped from files.");
+
+			int const fd = ::open(path, O_RDONLY);
+			if (fd == -1) {
+				throw std::system_error(errno, std::generic_category(), "open");
+			}
+
+			struct stat file_stat;
+			if (::fstat(fd, &file_stat) == -1) {
+				int const error = errno;
+				::close(fd);
+				throw std::system_error(error, std::generic_category(), "fstat");
+			}
+
+			std::size_t const bytes = static_cast<std::size_t>(file_stat.st_size);
+			std::size_t const size = bytes / sizeof(U);
+			if (size == 0) {
+				::close(fd);
+				return shared_array<T, AtomicRefCount>();
+			}
+
+			void* const storage = ::mmap(nullptr, bytes, protection, flags, fd, 0);
+			int const error = errno;
+			// The mapping remains valid after the file descriptor is closed.
+			::close(fd);
+			if (storage == MAP_FAILED) {
+				throw std::system_error(error, std::generic_category(), "mmap");
+			}
+
+			// Advice is only a hint, so failure is not an error.
+			switch (access) {
+			case map_access::sequential:
+				::madvise(storage, bytes, MADV_SEQUENTIAL);
+				break;
+			case map_access::random:
+				::madvise(storage, bytes, MADV_RANDOM);
+				break;
+			default:
+				break;
+			}
+			if (prefetch) {
+				::madvise(storage, bytes, MADV_WILLNEED);
+			}
+
+			return shared_array<T, AtomicRefCount>(static_cast<T*>(storage), size, storage, bytes, &unmap_file);
+		}
+
+	}
+
+
+	/* Maps the file at the given path into memory read-only, and returns a shared_array which shares ownership of the mapping, with the file's
+		contents interpreted as an array of T. Trailing bytes which do not make up a whole element are not accessible.
+		The file is unmapped once all shared_array objects sharing it are destroyed. No copy of the data is made, and the pages may be shared with
+		the page cache of other processes mapping the same file.
+		access is passed to the operating system as a hint about the expected access pattern. If prefetch is true, the operating system is also
+		advised to read the file in ahead of time (MADV_WILLNEED).
+		Throws std::system_error if the file cannot be opened or mapped. Only available on POSIX systems. */
+	template<typename T, bool AtomicRefCount = true>
+	shared_array<T const, AtomicRefCount> map_shared_array(char const* path, map_access access = map_access::normal, bool prefetch = false)
+	{
+		return detail::map_file<T const, T, AtomicRefCount>(path, PROT_READ, MAP_SHARED, access, prefetch);
+	}
+
+
+	/* Maps the file at the given path into memory copy-on-write, and returns a shared_array which shares ownership of the mapping, with the
+		file's contents interpreted as an array of T. Trailing bytes which do not make up a whole element are not accessible.
+		Elements may be modified, in which case the affected pages are copied; modifications are private and are not written back to the file.
+		Otherwise, behaves as map_shared_array. */
+	template<typename T, bool AtomicRefCount = true>
+	shared_array<T, AtomicRefCount> map_shared_array_copy_on_write(char const* path, map_access access = map_access::normal, bool prefetch = false)
+	{
+		return detail::map_file<T, T, AtomicRefCount>(path, PROT_READ | PROT_WRITE, MAP_PRIVATE, access, prefetch);
+	}
+
+}
+
+
+#endif
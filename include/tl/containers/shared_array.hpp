@@ -2,32 +2,171 @@
 #define TL_CONTAINERS_SHARED_ARRAY_HPP
 
 
-#include <atomic>			// std::atomic_size_t
+#include <algorithm>		// std::max
+#include <atomic>			// std::atomic_size_t, std::memory_order_acq_rel, std::memory_order_acquire, std::memory_order_relaxed
 #include <cstddef>			// std::size_t
+#include <iterator>			// std::distance, std::forward_iterator_tag, std::iterator_traits
+#include <limits>			// std::numeric_limits
 #include <memory>			// std::allocator, std::allocator_traits
-#include <type_traits>		// std::conditional_t
-#include <utility>			// std::swap
+#include <new>				// placement new, std::bad_array_new_length
+#include <type_traits>		// std::conditional_t, std::enable_if_t, std::is_base_of_v, std::is_pointer_v, std::remove_const_t
+#include <utility>			// std::forward, std::swap
 
-#include <tl/memory/allocate_default_construct.hpp>		// tl::memory::allocate_default_construct
-#include <tl/memory/destroy_deallocate.hpp>				// tl::memory::destroy_deallocate
-#include <tl/utility/assign_default.hpp>				// tl::utility::assign_default
+#include <tl/execution/thread_pool.hpp>				// tl::execution::thread_pool
+#include <tl/memory/assume_aligned.hpp>			// tl::memory::assume_aligned
+#include <tl/memory/copy_construct_n.hpp>			// tl::memory::copy_construct_n
+#include <tl/memory/default_construct_n.hpp>		// tl::memory::default_construct_n
+#include <tl/memory/default_initialize_n.hpp>		// tl::memory::default_initialize_n
+#include <tl/memory/destroy_n.hpp>					// tl::memory::destroy_n
+#include <tl/memory/fill_construct_n.hpp>			// tl::memory::fill_construct_n
+#include <tl/memory/parallel_default_construct_n.hpp>	// tl::memory::parallel_default_construct_n
 
 
 namespace tl::containers {
 
+	template<typename T, bool AtomicRefCount, class Allocator, std::size_t Alignment>
+	class weak_shared_array;
+
+	template<typename T, bool AtomicRefCount, class Allocator, std::size_t Alignment>
+	class shared_array_builder;
+
+
 	namespace detail {
 
-		// Stores the shared state for shared_array.
-		template<typename Pointer, typename SizeType, bool AtomicRefCount>
+		// Stores the shared state for shared_array. The array elements are stored in the same allocation, directly after this object.
+		template<typename SizeType, bool AtomicRefCount>
 		struct shared_array_state {
-			// Pointer to the actual array data.
-			Pointer data;
-
-			// Number of shared_array objects currently sharing the array.
+			// Number of shared_array objects currently sharing the array. The array elements are destroyed when this reaches 0.
 			std::conditional_t<AtomicRefCount, std::atomic_size_t, std::size_t> refs;
 
-			// Number of elements in the array pointed to by data.
+			/* Number of weak_shared_array objects referring to the array, plus 1 if refs is nonzero.
+				The allocation (including this object) is deallocated when this reaches 0. */
+			std::conditional_t<AtomicRefCount, std::atomic_size_t, std::size_t> weak_refs;
+
+			// Number of elements in the array.
 			SizeType size;
+
+			// Number of elements for which storage was allocated following this object. May be greater than size.
+			SizeType capacity;
+
+			// True if this object is a shared_array_external_state, in which case the elements are not stored in the same allocation.
+			bool external;
+		};
+
+
+		// Stores the shared state for a shared_array whose elements are stored in externally managed storage, rather than after the state object.
+		template<typename SizeType, bool AtomicRefCount>
+		struct shared_array_external_state : shared_array_state<SizeType, AtomicRefCount> {
+			// Pointer to the externally managed storage.
+			void* storage;
+
+			// Size in bytes of the externally managed storage.
+			std::size_t storage_bytes;
+
+			// Called to release the externally managed storage once refs reaches 0. The elements are not destroyed.
+			void (*release)(void* storage, std::size_t storage_bytes);
+		};
+
+
+		// Increments a reference count.
+		inline void increment_ref_count(std::size_t& count)
+		{
+			++count;
+		}
+
+
+		/* Increments a reference count.
+			Relaxed ordering is sufficient because a new reference can only be created from an existing one, which keeps the count above 0. */
+		inline void increment_ref_count(std::atomic_size_t& count)
+		{
+			count.fetch_add(1, std::memory_order_relaxed);
+		}
+
+
+		// Decrements a reference count and returns the new value.
+		inline std::size_t decrement_ref_count(std::size_t& count)
+		{
+			return --count;
+		}
+
+
+		/* Decrements a reference count and returns the new value.
+			Acquire-release ordering ensures all accesses through other references happen before destruction by whichever thread reaches 0. */
+		inline std::size_t decrement_ref_count(std::atomic_size_t& count)
+		{
+			return count.fetch_sub(1, std::memory_order_acq_rel) - 1;
+		}
+
+
+		// Gets the value of a reference count.
+		inline std::size_t load_ref_count(std::size_t const& count)
+		{
+			return count;
+		}
+
+
+		// Gets the value of a reference count.
+		inline std::size_t load_ref_count(std::atomic_size_t const& count)
+		{
+			return count.load(std::memory_order_acquire);
+		}
+
+
+		// Increments a reference count if it is not 0. Returns true if the count was incremented, otherwise false.
+		inline bool increment_if_nonzero(std::size_t& count)
+		{
+			if (count == 0) {
+				return false;
+			}
+			else {
+				++count;
+				return true;
+			}
+		}
+
+
+		// Increments a reference count if it is not 0. Returns true if the count was incremented, otherwise false.
+		inline bool increment_if_nonzero(std::atomic_size_t& count)
+		{
+			std::size_t current = count.load(std::memory_order_relaxed);
+			while (current != 0) {
+				if (count.compare_exchange_weak(current, current + 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+
+		/* Describes the layout of a single allocation holding a shared_array_state followed by the array elements.
+			The first element is aligned to DataAlignment bytes. */
+		template<typename T, class State, std::size_t DataAlignment>
+		struct shared_array_block {
+			// Alignment of the allocation, sufficient for both the state object and the elements.
+			static constexpr std::size_t alignment = std::max(alignof(State), DataAlignment);
+
+			// Unit in which the allocation is made, such that an allocator rebound to this type provides the required alignment.
+			struct alignas(alignment) unit {
+				unsigned char bytes[alignment];
+			};
+
+			// Offset in bytes from the start of the allocation to the first element.
+			static constexpr std::size_t data_offset = (sizeof(State) + DataAlignment - 1) / DataAlignment * DataAlignment;
+
+			// Maximum number of elements for which the size of the allocation in bytes (rounded up to a whole unit) is representable.
+			static constexpr std::size_t max_count = (std::numeric_limits<std::size_t>::max() - data_offset - (sizeof(unit) - 1)) / sizeof(T);
+
+			// Gets the number of units to allocate for an array of count elements, which must not be greater than max_count.
+			static constexpr std::size_t units(std::size_t count)
+			{
+				return (data_offset + count * sizeof(T) + sizeof(unit) - 1) / sizeof(unit);
+			}
+
+			// Gets a pointer to the first element of the array belonging to the given state object.
+			static T* data(State* state)
+			{
+				return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(state) + data_offset);
+			}
 		};
 
 	}
@@ -35,10 +174,26 @@ namespace tl::containers {
 
 	/* Manages an array whose ownership can be shared by multiple shared_array objects.
 		Once all shared_array objects sharing an array are destroyed, the array is also destroyed.
+		A weak_shared_array may be used to refer to the array without taking ownership; the storage is deallocated once it is no longer referred to
+		by any shared_array or weak_shared_array.
+		The reference counts, size and elements are stored in a single allocation, and each shared_array object also holds the data pointer and size
+		directly, so element access does not need to go through the shared state.
+		Alternatively, a shared_array may take ownership of elements in externally managed storage, such as a memory-mapped file.
+		T may be const-qualified, in which case the elements can only be initialized on construction. The allocator always allocates the
+		non-const-qualified type.
 		If AtomicRefCount is true then a single array can be safely shared across multiple threads, but may introduce a slight performance overhead
-		(however, individual array elements remain unsychronised and the user must ensure appropriate thread safety). */
-	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<T>>
+		(however, individual array elements remain unsychronised and the user must ensure appropriate thread safety).
+		Where many copies are made and destroyed within one thread, local_shared_array can be used to avoid most of the atomic operations.
+		The first element of the array is aligned to Alignment bytes, which may be larger than alignof(T) (eg. 32 or 64 for SIMD code).
+		If Alignment is larger than sizeof(T), the array is also padded at the end with extra elements (constructed in the same manner as the
+		other elements), such that the total
+		number of elements is a multiple of Alignment / sizeof(T). The padding elements may be freely read and written, for example by vectorised
+		loops which process whole vectors without a scalar remainder loop, but are not part of the range [begin(), end()). */
+	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
 	class shared_array {
+		static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of 2.");
+		static_assert(Alignment >= alignof(T), "Alignment must be at least alignof(T).");
+
 	public:
 		/* Member types */
 
@@ -47,40 +202,56 @@ namespace tl::containers {
 		using size_type = typename std::allocator_traits<Allocator>::size_type;
 		using reference = T&;
 		using const_reference = T const&;
-		using pointer = typename std::allocator_traits<Allocator>::pointer;
-		using const_pointer = typename std::allocator_traits<Allocator>::const_pointer;
+		using pointer = typename std::pointer_traits<typename std::allocator_traits<Allocator>::pointer>::template rebind<T>;
+		using const_pointer = typename std::pointer_traits<typename std::allocator_traits<Allocator>::pointer>::template rebind<T const>;
 		using iterator = pointer;
 		using const_iterator = const_pointer;
 
 
+		/* Static variables */
+
+		// Guaranteed alignment, in bytes, of the first element of the array.
+		static constexpr std::size_t alignment = Alignment;
+
+
 		/* Special members */
 
 		// If this is the last shared_array object sharing the array, the array is destroyed. Destructs allocator.
 		~shared_array()
 		{
-			if (_state && --_state->refs == 0) {
-				// Destroy the array.
-				memory::destroy_deallocate(_alloc, _state->data, _state->size);
-
-				// Destroy the shared state object.
-				_state_alloc_t state_alloc(_alloc);
-				memory::destroy_deallocate(state_alloc, _state, 1);
+			if (_state && detail::decrement_ref_count(_state->refs) == 0) {
+				if (_state->external) {
+					// Release the external storage.
+					auto& state = static_cast<_external_state_t&>(*_state);
+					state.release(state.storage, state.storage_bytes);
+				}
+				else {
+					// Destroy the array.
+					memory::destroy_n(_alloc, _block_t::data(_state), _state->size);
+				}
+
+				// Release the weak reference held collectively by the shared_array objects.
+				_release_weak(_alloc, _state);
 			}
 		}
 
 		// Constructs to have no array and default constructs the allocator.
 		shared_array() :
 			_alloc(),
-			_state()
+			_state(),
+			_data(),
+			_size()
 		{}
 
 		// Constructs to share ownership of other's array, and copy-constructs allocator from other.
 		shared_array(shared_array const& other) :
 			_alloc(other._alloc),
-			_state(other._state)
+			_state(other._state),
+			_data(other._data),
+			_size(other._size)
 		{
 			if (_state) {
-				++_state->refs;
+				detail::increment_ref_count(_state->refs);
 			}
 		}
 
@@ -91,16 +262,79 @@ namespace tl::containers {
 			swap(*this, other);
 		}
 
-		// Constructs the allocator from the given value then constructs an array of the given size with default-constructed elements.
+		/* Constructs the allocator from the given value then constructs an array of the given size with default-constructed elements.
+			The shared state and the elements (including any padding elements) are obtained from a single allocation. */
 		shared_array(size_type size, Allocator alloc = Allocator()) :
 			_alloc(alloc),
-			_state(memory::allocate_default_construct(_state_alloc_t(_alloc)))
+			_state(_allocate_state(_alloc, _padded_size(size))),
+			_data(_block_t::data(_state)),
+			_size(size)
+		{
+			try {
+				memory::default_construct_n(_alloc, _block_t::data(_state), _state->size);
+			}
+			catch (...) {
+				_release_weak(_alloc, _state);
+				throw;
+			}
+		}
+
+		/* Constructs the allocator from the given value then constructs an array of the given size with elements copy-constructed from value.
+			For trivially copyable T this is performed as a single fill operation (eg. memset) rather than element by element. */
+		shared_array(size_type size, T const& value, Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(_allocate_state(_alloc, _padded_size(size))),
+			_data(_block_t::data(_state)),
+			_size(size)
 		{
-			_state->data = memory::allocate_default_construct(_alloc, size);
-			_state->refs = 1;
-			_state->size = size;
+			try {
+				memory::fill_construct_n(_alloc, _block_t::data(_state), _state->size, value);
+			}
+			catch (...) {
+				_release_weak(_alloc, _state);
+				throw;
+			}
 		}
 
+		/* Constructs the allocator from the given value then constructs an array with elements copy-constructed from the range [first, last).
+			Any padding elements are default-constructed. */
+		template<class ForwardIterator, typename = std::enable_if_t<std::is_base_of_v<std::forward_iterator_tag,
+			typename std::iterator_traits<ForwardIterator>::iterator_category>>>
+		shared_array(ForwardIterator first, ForwardIterator last, Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(_allocate_state(_alloc, _padded_size(static_cast<size_type>(std::distance(first, last))))),
+			_data(_block_t::data(_state)),
+			_size(static_cast<size_type>(std::distance(first, last)))
+		{
+			try {
+				memory::copy_construct_n(_alloc, _block_t::data(_state), first, _size);
+				try {
+					memory::default_construct_n(_alloc, _block_t::data(_state) + _size, _state->size - _size);
+				}
+				catch (...) {
+					memory::destroy_n(_alloc, _block_t::data(_state), _size);
+					throw;
+				}
+			}
+			catch (...) {
+				_release_weak(_alloc, _state);
+				throw;
+			}
+		}
+
+		/* Constructs to take ownership of an array of size elements starting at data, which resides in externally managed storage (eg. a
+			memory-mapped file), and constructs the allocator from the given value. The allocator is only used to allocate the shared state.
+			The elements are not destroyed by shared_array; instead, once no shared_array objects share the array, release(storage, storage_bytes)
+			is called. If allocation of the shared state fails, release is called immediately.
+			data must be aligned to Alignment bytes, and the storage must be readable up to padded_size() elements. */
+		shared_array(pointer data, size_type size, void* storage, std::size_t storage_bytes, void (*release)(void*, std::size_t),
+				Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(_allocate_external_state(_alloc, size, storage, storage_bytes, release)),
+			_data(data),
+			_size(size)
+		{}
+
 
 		/* Operators */
 
@@ -115,70 +349,128 @@ namespace tl::containers {
 		// Gets a reference to the element at the given index.
 		reference operator[](size_type i)
 		{
-			return _state->data[i];
+			return _data[i];
 		}
 
 		// Gets a const reference to the element at the given index.
 		const_reference operator[](size_type i) const
 		{
-			return _state->data[i];
+			return _data[i];
 		}
 
 
 		/* General functions */
 
-		// Gets an iterator to the start of the array.
+		// Gets an iterator to the start of the array. The compiler is informed of the alignment of the iterator, if possible.
 		iterator begin()
 		{
-			return _state->data;
+			return _aligned_data();
 		}
 
-		// Gets a const iterator to the start of the array.
+		// Gets a const iterator to the start of the array. The compiler is informed of the alignment of the iterator, if possible.
 		iterator begin() const
 		{
-			return _state->data;
+			return _aligned_data();
 		}
 
-		// Gets a const iterator to the start of the array.
+		// Gets a const iterator to the start of the array. The compiler is informed of the alignment of the iterator, if possible.
 		iterator cbegin() const
 		{
-			return _state->data;
+			return _aligned_data();
 		}
 
 		// Gets an const iterator to the end of the array.
 		iterator cend() const
 		{
-			return _state->data + _state->size;
+			return _aligned_data() + _size;
 		}
 
-		// Gets a pointer to the start of the array.
+		// Gets a pointer to the start of the array. The compiler is informed of the alignment of the pointer, if possible.
 		pointer data()
 		{
-			return _state->data;
+			return _aligned_data();
 		}
 
-		// Gets a const pointer to the start of the array.
+		// Gets a const pointer to the start of the array. The compiler is informed of the alignment of the pointer, if possible.
 		const_pointer data() const
 		{
-			return _state->data;
+			return _aligned_data();
+		}
+
+		// Gets a copy of the allocator.
+		allocator_type get_allocator() const
+		{
+			return _alloc;
 		}
 
 		// Gets an iterator to the end of the array.
 		iterator end()
 		{
-			return _state->data + _state->size;
+			return _aligned_data() + _size;
 		}
 
 		// Gets an const iterator to the end of the array.
 		iterator end() const
 		{
-			return _state->data + _state->size;
+			return _aligned_data() + _size;
 		}
 
-		// Gets the number of elements in the array.
+		// Gets the number of elements in the array, excluding any padding.
 		size_type size() const
 		{
-			return _state->size;
+			return _size;
+		}
+
+		// Gets the number of elements in the array, including any padding at the end.
+		size_type padded_size() const
+		{
+			return _padded_size(_size);
+		}
+
+		/* Returns true if this is the only shared_array object sharing the array, otherwise false.
+			If AtomicRefCount is true and other threads may concurrently create or destroy shared_array objects sharing the array (eg. through
+			weak_shared_array::lock()), the result may be immediately out of date. */
+		bool unique() const
+		{
+			return use_count() == 1;
+		}
+
+		/* Gets the number of shared_array objects sharing the array, or 0 if there is no array.
+			If AtomicRefCount is true and other threads may concurrently create or destroy shared_array objects sharing the array, the result may
+			be immediately out of date. */
+		size_type use_count() const
+		{
+			return _state ? static_cast<size_type>(detail::load_ref_count(_state->refs)) : 0;
+		}
+
+
+		/* Static functions */
+
+		/* Constructs the allocator from the given value then creates an array of the given size whose elements are default-initialized.
+			For trivially default constructible T the elements are left uninitialized, avoiding the cost of zeroing an array which is about to be
+			entirely overwritten (eg. by reading from a file or socket). Otherwise, equivalent to shared_array(size, alloc). */
+		static shared_array for_overwrite(size_type size, Allocator alloc = Allocator())
+		{
+			return shared_array(_for_overwrite_tag(), size, alloc);
+		}
+
+		/* Constructs the allocator from the given value then creates an array of the given size with default-constructed elements, which are
+			constructed in parallel by the given number of threads.
+			The elements are divided between the threads with execution::static_partition, so on a NUMA system each part of the array is placed
+			on the node of the thread which constructed it (see memory::parallel_default_construct_n). The threads are not reused, so later work
+			is not guaranteed to run on the same nodes; use the thread_pool overload for that. */
+		static shared_array parallel_construct(size_type size, std::size_t threads, Allocator alloc = Allocator())
+		{
+			return shared_array(_parallel_tag(), size, threads, alloc);
+		}
+
+		/* Constructs the allocator from the given value then creates an array of the given size with default-constructed elements, which are
+			constructed in parallel by the workers of the given pool, one part per worker (see memory::parallel_default_construct_n).
+			Parallel algorithms of tl::ranges using execution::pool_policy::pinned(pool) over the array then process each element on the worker
+			which constructed it, so if the workers are pinned to CPUs, they access memory local to their NUMA node. */
+		static shared_array parallel_construct(size_type size, execution::thread_pool& pool, Allocator alloc = Allocator())
+		{
+			return shared_array(_parallel_tag(), size, pool, alloc);
 		}
 
 
@@ -191,18 +483,179 @@ namespace tl::containers {
 
 			swap(first._alloc, second._alloc);
 			swap(first._state, second._state);
+			swap(first._data, second._data);
+			swap(first._size, second._size);
 		}
 
 
 	private:
 		/* Member types */
 
-		using _state_t = detail::shared_array_state<pointer, size_type, AtomicRefCount>;
+		using _state_t = detail::shared_array_state<size_type, AtomicRefCount>;
+
+		using _external_state_t = detail::shared_array_external_state<size_type, AtomicRefCount>;
+
+		// Allocator type to be used for allocation of the shared state object for arrays in external storage.
+		using _external_state_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<_external_state_t>;
+
+		// Layout of the combined shared state and array storage.
+		using _block_t = detail::shared_array_block<std::remove_const_t<T>, _state_t, Alignment>;
+
+		using _block_unit = typename _block_t::unit;
+
+		// Allocator type to be used for allocation of the combined shared state and array storage.
+		using _block_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<_block_unit>;
+
+
+		/* Static variables */
+
+		// Number of elements to which the padded size of an array is a multiple.
+		static constexpr size_type _padding_multiple = Alignment > sizeof(T) ? Alignment / sizeof(T) : 1;
+
+		// Maximum size of an array, such that its padded size is not greater than the maximum number of elements of a block.
+		static constexpr size_type _max_size = _block_t::max_count / _padding_multiple * _padding_multiple;
+
+		// Tag type to select the constructor used by for_overwrite().
+		struct _for_overwrite_tag {};
+
+		// Tag type to select the constructor used by parallel_construct().
+		struct _parallel_tag {};
+
+		// Tag type to select the constructor which takes ownership of an existing reference to a shared state.
+		struct _adopt_tag {};
+
+
+		/* Special members */
+
+		// Constructs the allocator from the given value then constructs an array of the given size with default-initialized elements.
+		shared_array(_for_overwrite_tag, size_type size, Allocator alloc) :
+			_alloc(alloc),
+			_state(_allocate_state(_alloc, _padded_size(size))),
+			_data(_block_t::data(_state)),
+			_size(size)
+		{
+			try {
+				memory::default_initialize_n(_alloc, _block_t::data(_state), _state->size);
+			}
+			catch (...) {
+				_release_weak(_alloc, _state);
+				throw;
+			}
+		}
+
+		/* Constructs the allocator from the given value then constructs an array of the given size with default-constructed elements, using the
+			given number of threads or thread_pool. */
+		template<typename Threads>
+		shared_array(_parallel_tag, size_type size, Threads&& threads, Allocator alloc) :
+			_alloc(alloc),
+			_state(_allocate_state(_alloc, _padded_size(size))),
+			_data(_block_t::data(_state)),
+			_size(size)
+		{
+			try {
+				// The padding is constructed separately, so the elements are partitioned exactly as parallel algorithms over [begin(), end()) are.
+				memory::parallel_default_construct_n(_alloc, _block_t::data(_state), size, std::forward<Threads>(threads));
+				try {
+					memory::default_construct_n(_alloc, _block_t::data(_state) + size, _state->size - size);
+				}
+				catch (...) {
+					memory::destroy_n(_alloc, _block_t::data(_state), size);
+					throw;
+				}
+			}
+			catch (...) {
+				_release_weak(_alloc, _state);
+				throw;
+			}
+		}
+
+		/* Constructs to share ownership of the array with the given shared state, data and size, and constructs the allocator from the given value.
+			The caller must have already incremented the state's reference count on behalf of this object. */
+		shared_array(_adopt_tag, Allocator alloc, _state_t* state, pointer data, size_type size) :
+			_alloc(alloc),
+			_state(state),
+			_data(data),
+			_size(size)
+		{}
+
+
+		/* Static functions */
+
+		/* Gets the number of elements to construct for an array of the given size, such that the array is padded to a multiple of Alignment bytes.
+			Throws std::bad_array_new_length if size is greater than _max_size. */
+		static constexpr size_type _padded_size(size_type size)
+		{
+			if (size > _max_size) {
+				throw std::bad_array_new_length();
+			}
+			return (size + _padding_multiple - 1) / _padding_multiple * _padding_multiple;
+		}
+
+		/* Allocates storage for the shared state and an array of the given size, and constructs the shared state with a reference count of 1.
+			The size and capacity of the state are both set to size. Throws std::bad_array_new_length if the size of the storage is not
+			representable. */
+		static _state_t* _allocate_state(Allocator& alloc, size_type size)
+		{
+			if (size > _block_t::max_count) {
+				throw std::bad_array_new_length();
+			}
+			_block_alloc_t block_alloc(alloc);
+			_block_unit* block = std::allocator_traits<_block_alloc_t>::allocate(block_alloc, _block_t::units(size));
+			return ::new(static_cast<void*>(block)) _state_t{1, 1, size, size, false};
+		}
+
+		// Allocates and constructs the shared state for an array in external storage, with a reference count of 1.
+		static _state_t* _allocate_external_state(Allocator& alloc, size_type size, void* storage, std::size_t storage_bytes,
+			void (*release)(void*, std::size_t))
+		{
+			_external_state_alloc_t state_alloc(alloc);
+			_external_state_t* state;
+			try {
+				state = std::allocator_traits<_external_state_alloc_t>::allocate(state_alloc, 1);
+			}
+			catch (...) {
+				release(storage, storage_bytes);
+				throw;
+			}
+			return ::new(static_cast<void*>(state)) _external_state_t{{1, 1, size, 0, true}, storage, storage_bytes, release};
+		}
+
+		// Decrements the weak reference count of the given shared state, and if it reaches 0, deallocates the state and array storage.
+		static void _release_weak(Allocator& alloc, _state_t* state)
+		{
+			// If the count is 1 then there are no weak_shared_array objects, and none can be created as there are no shared_array objects left.
+			if (detail::load_ref_count(state->weak_refs) == 1 || detail::decrement_ref_count(state->weak_refs) == 0) {
+				if (state->external) {
+					_external_state_alloc_t state_alloc(alloc);
+					std::allocator_traits<_external_state_alloc_t>::deallocate(state_alloc, static_cast<_external_state_t*>(state), 1);
+				}
+				else {
+					_block_alloc_t block_alloc(alloc);
+					std::allocator_traits<_block_alloc_t>::deallocate(block_alloc, reinterpret_cast<_block_unit*>(state), _block_t::units(state->capacity));
+				}
+			}
+		}
+
+
+		/* General functions */
+
+		// Gets the pointer to the first element, with its alignment made known to the compiler if the pointer is a raw pointer.
+		pointer _aligned_data() const
+		{
+			if constexpr (std::is_pointer_v<pointer>) {
+				return memory::assume_aligned<Alignment>(_data);
+			}
+			else {
+				return _data;
+			}
+		}
 
-		// Allocator type to be used for allocation of the shared state object.
-		using _state_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<_state_t>;
 
-		using _state_pointer = typename std::allocator_traits<_state_alloc_t>::pointer;
+		/* Friends */
+
+		friend class weak_shared_array<T, AtomicRefCount, Allocator, Alignment>;
+
+		friend class shared_array_builder<T, AtomicRefCount, Allocator, Alignment>;
 
 
 		/* Variables */
@@ -211,10 +664,36 @@ namespace tl::containers {
 			Mutable because const-qualified allocators aren't required to be useful. */
 		mutable Allocator _alloc;
 
-		// Pointer to the shared array state.
-		_state_pointer _state;
+		// Pointer to the shared array state, which is immediately followed by the array elements.
+		_state_t* _state;
+
+		// Pointer to the first element of the array.
+		pointer _data;
+
+		// Number of elements in the array.
+		size_type _size;
 	};
 
+
+	/* Creates a shared_array of the given size with default-constructed elements, using std::allocator.
+		The shared state and the elements are obtained from a single allocation. */
+	template<typename T, bool AtomicRefCount = true, std::size_t Alignment = alignof(T)>
+	shared_array<T, AtomicRefCount, std::allocator<std::remove_const_t<T>>, Alignment> make_shared_array(std::size_t size)
+	{
+		return shared_array<T, AtomicRefCount, std::allocator<std::remove_const_t<T>>, Alignment>(size);
+	}
+
+
+	/* Creates a shared_array of the given size with default-constructed elements, using a copy of alloc rebound to T.
+		The shared state and the elements are obtained from a single allocation. */
+	template<typename T, bool AtomicRefCount = true, std::size_t Alignment = alignof(T), class Allocator>
+	shared_array<T, AtomicRefCount, typename std::allocator_traits<Allocator>::template rebind_alloc<std::remove_const_t<T>>, Alignment>
+		allocate_shared_array(Allocator const& alloc, typename std::allocator_traits<Allocator>::size_type size)
+	{
+		using array_type = shared_array<T, AtomicRefCount, typename std::allocator_traits<Allocator>::template rebind_alloc<std::remove_const_t<T>>, Alignment>;
+		return array_type(size, typename array_type::allocator_type(alloc));
+	}
+
 }
 
 
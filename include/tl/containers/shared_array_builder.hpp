@@ -0,0 +1,330 @@
+#ifndef TL_CONTAINERS_SHARED_ARRAY_BUILDER_HPP
+#define TL_CONTAINERS_SHARED_ARRAY_BUILDER_HPP
+
+
+#include <algorithm>		// std::max, std::min
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator, std::allocator_traits
+#include <stdexcept>		// std::length_error
+#include <type_traits>		// std::remove_const_t
+#include <utility>			// std::forward, std::move, std::swap
+
+#include <tl/containers/shared_array.hpp>			// tl::containers::shared_array
+#include <tl/memory/default_construct_n.hpp>		// tl::memory::default_construct_n
+#include <tl/memory/destroy_n.hpp>					// tl::memory::destroy_n
+#include <tl/memory/relocate_n.hpp>					// tl::memory::relocate_n
+
+
+namespace tl::containers {
+
+	/* Builds up an array of unknown size by appending elements, then converts it into a shared_array without copying.
+		Storage grows geometrically, so appending is amortized constant time. The storage has the same layout as that of a shared_array, so
+		build() simply transfers the allocation to the new shared_array. Elements are relocated with memcpy when the storage grows, if T is
+		trivially copyable.
+		Any unused capacity remains allocated for the lifetime of the built array; call shrink_to_fit() before build() to avoid this. */
+	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
+	class shared_array_builder {
+	public:
+		/* Member types */
+
+		using array_type = shared_array<T, AtomicRefCount, Allocator, Alignment>;
+		using value_type = std::remove_const_t<T>;
+		using allocator_type = Allocator;
+		using size_type = typename array_type::size_type;
+		using reference = value_type&;
+		using const_reference = value_type const&;
+		using pointer = value_type*;
+		using const_pointer = value_type const*;
+		using iterator = pointer;
+		using const_iterator = const_pointer;
+
+
+		/* Special members */
+
+		// Destroys the elements appended so far and deallocates the storage. Destructs allocator.
+		~shared_array_builder()
+		{
+			if (_state) {
+				memory::destroy_n(_alloc, _data(), _size);
+				array_type::_release_weak(_alloc, _state);
+			}
+		}
+
+		// Constructs with no elements and no storage, and constructs the allocator from the given value.
+		explicit shared_array_builder(Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(),
+			_size()
+		{}
+
+		shared_array_builder(shared_array_builder const& other) = delete;
+
+		// Transfers other's elements and storage to this, and move-constructs allocator from other.
+		shared_array_builder(shared_array_builder&& other) :
+			shared_array_builder()
+		{
+			swap(*this, other);
+		}
+
+
+		/* Operators */
+
+		shared_array_builder& operator=(shared_array_builder const& rhs) = delete;
+
+		// Releases the current elements and storage, then transfers rhs's elements and storage to this, and move-assigns allocator from rhs.
+		shared_array_builder& operator=(shared_array_builder&& rhs)
+		{
+			shared_array_builder tmp(std::move(rhs));
+			swap(*this, tmp);
+
+			return *this;
+		}
+
+		// Gets a reference to the element at the given index.
+		reference operator[](size_type i)
+		{
+			return _data()[i];
+		}
+
+		// Gets a const reference to the element at the given index.
+		const_reference operator[](size_type i) const
+		{
+			return _data()[i];
+		}
+
+
+		/* General functions */
+
+		// Gets an iterator to the first element. Invalidated when the storage grows.
+		iterator begin()
+		{
+			return _data();
+		}
+
+		// Gets a const iterator to the first element. Invalidated when the storage grows.
+		const_iterator begin() const
+		{
+			return _data();
+		}
+
+		/* Transfers the elements to a new shared_array and returns it, leaving this object with no elements or storage.
+			No elements are copied; if the array requires padding, the padding elements are default-constructed (which may grow the storage). */
+		array_type build()
+		{
+			if (!_state) {
+				return array_type();
+			}
+
+			size_type const padded_size = array_type::_padded_size(_size);
+			if (padded_size > _state->capacity) {
+				_reallocate(padded_size);
+			}
+			memory::default_construct_n(_alloc, _data() + _size, padded_size - _size);
+			_state->size = padded_size;
+
+			array_type result(typename array_type::_adopt_tag(), _alloc, _state, _data(), _size);
+			_state = nullptr;
+			_size = 0;
+
+			return result;
+		}
+
+		// Gets the number of elements for which storage is currently allocated.
+		size_type capacity() const
+		{
+			return _state ? _state->capacity : 0;
+		}
+
+		// Destroys all the elements, but retains the storage.
+		void clear()
+		{
+			if (_state) {
+				memory::destroy_n(_alloc, _data(), _size);
+				_size = 0;
+			}
+		}
+
+		// Gets a pointer to the first element. Invalidated when the storage grows.
+		pointer data()
+		{
+			return _data();
+		}
+
+		// Gets a const pointer to the first element. Invalidated when the storage grows.
+		const_pointer data() const
+		{
+			return _data();
+		}
+
+		// Constructs a new element at the end from the given arguments, growing the storage if required. Returns a reference to the new element.
+		template<typename... Args>
+		reference emplace_back(Args&&... args)
+		{
+			if (_size == capacity()) {
+				// The new element is constructed before relocating the existing elements, in case args refer to an existing element.
+				_state_t* const new_state = array_type::_allocate_state(_alloc, _grown_capacity());
+				try {
+					std::allocator_traits<Allocator>::construct(_alloc, _block_t::data(new_state) + _size, std::forward<Args>(args)...);
+				}
+				catch (...) {
+					array_type::_release_weak(_alloc, new_state);
+					throw;
+				}
+				try {
+					_relocate(new_state);
+				}
+				catch (...) {
+					std::allocator_traits<Allocator>::destroy(_alloc, _block_t::data(new_state) + _size);
+					array_type::_release_weak(_alloc, new_state);
+					throw;
+				}
+			}
+			else {
+				std::allocator_traits<Allocator>::construct(_alloc, _data() + _size, std::forward<Args>(args)...);
+			}
+			++_size;
+
+			return _data()[_size - 1];
+		}
+
+		// Gets an iterator to one past the last element. Invalidated when the storage grows.
+		iterator end()
+		{
+			return _data() + _size;
+		}
+
+		// Gets a const iterator to one past the last element. Invalidated when the storage grows.
+		const_iterator end() const
+		{
+			return _data() + _size;
+		}
+
+		// Copy constructs a new element at the end from value, growing the storage if required.
+		void push_back(value_type const& value)
+		{
+			emplace_back(value);
+		}
+
+		// Move constructs a new element at the end from value, growing the storage if required.
+		void push_back(value_type&& value)
+		{
+			emplace_back(std::move(value));
+		}
+
+		/* Ensures storage is allocated for at least the given number of elements. Throws std::length_error if capacity is greater than the maximum
+			size of a shared_array. */
+		void reserve(size_type capacity)
+		{
+			if (capacity > array_type::_max_size) {
+				throw std::length_error("shared_array_builder::reserve");
+			}
+			if (capacity > this->capacity()) {
+				_reallocate(capacity);
+			}
+		}
+
+		// Reallocates the storage such that there is no unused capacity, other than that required for padding.
+		void shrink_to_fit()
+		{
+			size_type const padded_size = array_type::_padded_size(_size);
+			if (_state && padded_size < _state->capacity) {
+				_reallocate(padded_size);
+			}
+		}
+
+		// Gets the number of elements appended so far.
+		size_type size() const
+		{
+			return _size;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(shared_array_builder& first, shared_array_builder& second)
+		{
+			using std::swap;
+
+			swap(first._alloc, second._alloc);
+			swap(first._state, second._state);
+			swap(first._size, second._size);
+		}
+
+
+	private:
+		/* Member types */
+
+		using _state_t = typename array_type::_state_t;
+
+		using _block_t = typename array_type::_block_t;
+
+
+		/* Static variables */
+
+		// Capacity of the storage first allocated by emplace_back().
+		static constexpr size_type _min_capacity = 8;
+
+
+		/* General functions */
+
+		// Gets a pointer to the first element, or null if there is no storage.
+		pointer _data() const
+		{
+			return _state ? _block_t::data(_state) : nullptr;
+		}
+
+		/* Gets the capacity to which the storage grows when it is full: twice the number of elements (and at least _min_capacity), but no more
+			than the maximum size of a shared_array. Throws std::length_error if the number of elements is already the maximum. */
+		size_type _grown_capacity() const
+		{
+			constexpr size_type max_size = array_type::_max_size;
+			if (_size >= max_size) {
+				throw std::length_error("shared_array_builder::emplace_back");
+			}
+			return _size <= max_size / 2 ? std::min(std::max<size_type>(2 * _size, _min_capacity), max_size) : max_size;
+		}
+
+		/* Allocates new storage with the given capacity (which must not be less than the number of elements), and relocates the elements into it.
+			If relocation throws, the new storage is deallocated and the current storage and elements are retained. */
+		void _reallocate(size_type capacity)
+		{
+			_state_t* const new_state = array_type::_allocate_state(_alloc, capacity);
+			try {
+				_relocate(new_state);
+			}
+			catch (...) {
+				array_type::_release_weak(_alloc, new_state);
+				throw;
+			}
+		}
+
+		/* Relocates the elements into the storage following new_state, then deallocates the current storage and adopts new_state.
+			If relocation throws, the current storage and elements are retained, and new_state is not adopted. */
+		void _relocate(_state_t* new_state)
+		{
+			if (_state) {
+				memory::relocate_n(_alloc, _block_t::data(_state), _block_t::data(new_state), _size);
+				array_type::_release_weak(_alloc, _state);
+			}
+			_state = new_state;
+		}
+
+
+		/* Variables */
+
+		/* Allocator to use for all memory allocations.
+			Mutable because const-qualified allocators aren't required to be useful. */
+		mutable Allocator _alloc;
+
+		// Pointer to the shared array state, which is immediately followed by the storage for the elements.
+		_state_t* _state;
+
+		// Number of elements appended so far.
+		size_type _size;
+	};
+
+}
+
+
+#endif
@@ -0,0 +1,200 @@
+#ifndef TL_CONTAINERS_SHARED_ARRAY_VIEW_HPP
+#define TL_CONTAINERS_SHARED_ARRAY_VIEW_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator
+#include <type_traits>		// std::remove_const_t
+#include <utility>			// std::move, std::swap
+
+#include <tl/containers/shared_array.hpp>		// tl::containers::shared_array
+
+
+namespace tl::containers {
+
+	/* Refers to a contiguous subrange of an array managed by shared_array, and shares ownership of that array.
+		Copying a shared_array_view shares ownership of the same array (ie. it increments the same reference count as the shared_array objects),
+		so a single allocation can be partitioned between many consumers without copying, and without any separate lifetime management.
+		The array is destroyed once all shared_array and shared_array_view objects sharing it are destroyed.
+		Unlike shared_array, the start of the subrange is only guaranteed to be aligned to alignof(T). */
+	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
+	class shared_array_view {
+	public:
+		/* Member types */
+
+		using array_type = shared_array<T, AtomicRefCount, Allocator, Alignment>;
+		using value_type = typename array_type::value_type;
+		using size_type = typename array_type::size_type;
+		using reference = typename array_type::reference;
+		using const_reference = typename array_type::const_reference;
+		using pointer = typename array_type::pointer;
+		using const_pointer = typename array_type::const_pointer;
+		using iterator = typename array_type::iterator;
+		using const_iterator = typename array_type::const_iterator;
+
+
+		/* Special members */
+
+		// Releases ownership of the array. If this is the last object sharing the array, the array is destroyed.
+		~shared_array_view() = default;
+
+		// Constructs to refer to no array.
+		shared_array_view() :
+			_array(),
+			_data(),
+			_size()
+		{}
+
+		// Constructs to share ownership of other's array and refer to the same subrange.
+		shared_array_view(shared_array_view const& other) = default;
+
+		// Transfers ownership of other's array to this and refers to the same subrange.
+		shared_array_view(shared_array_view&& other) :
+			shared_array_view()
+		{
+			swap(*this, other);
+		}
+
+		// Constructs to share ownership of the given array and refer to all of its elements.
+		shared_array_view(array_type array) :
+			_array(std::move(array)),
+			_data(_array.data()),
+			_size(_array.size())
+		{}
+
+		/* Constructs to share ownership of the given array and refer to count elements starting at index offset.
+			offset + count must not be greater than array.size(). */
+		shared_array_view(array_type array, size_type offset, size_type count) :
+			_array(std::move(array)),
+			_data(_array.data() + offset),
+			_size(count)
+		{}
+
+
+		/* Operators */
+
+		// Releases ownership of the current array, shares ownership of rhs's array, and refers to the same subrange as rhs.
+		shared_array_view& operator=(shared_array_view rhs)
+		{
+			swap(*this, rhs);
+
+			return *this;
+		}
+
+		// Gets a reference to the element at the given index within the subrange.
+		reference operator[](size_type i)
+		{
+			return _data[i];
+		}
+
+		// Gets a const reference to the element at the given index within the subrange.
+		const_reference operator[](size_type i) const
+		{
+			return _data[i];
+		}
+
+
+		/* General functions */
+
+		// Gets the array whose ownership is shared.
+		array_type const& array() const
+		{
+			return _array;
+		}
+
+		// Gets an iterator to the start of the subrange.
+		iterator begin()
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the start of the subrange.
+		iterator begin() const
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the start of the subrange.
+		iterator cbegin() const
+		{
+			return _data;
+		}
+
+		// Gets a const iterator to the end of the subrange.
+		iterator cend() const
+		{
+			return _data + _size;
+		}
+
+		// Gets a pointer to the start of the subrange.
+		pointer data()
+		{
+			return _data;
+		}
+
+		// Gets a const pointer to the start of the subrange.
+		const_pointer data() const
+		{
+			return _data;
+		}
+
+		// Gets an iterator to the end of the subrange.
+		iterator end()
+		{
+			return _data + _size;
+		}
+
+		// Gets a const iterator to the end of the subrange.
+		iterator end() const
+		{
+			return _data + _size;
+		}
+
+		// Gets the number of elements in the subrange.
+		size_type size() const
+		{
+			return _size;
+		}
+
+		/* Gets a view which shares ownership of the same array and refers to count elements starting at index offset of this subrange.
+			offset + count must not be greater than size(). */
+		shared_array_view subview(size_type offset, size_type count) const
+		{
+			shared_array_view result(*this);
+			result._data += offset;
+			result._size = count;
+
+			return result;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(shared_array_view& first, shared_array_view& second)
+		{
+			using std::swap;
+
+			swap(first._array, second._array);
+			swap(first._data, second._data);
+			swap(first._size, second._size);
+		}
+
+
+	private:
+		/* Variables */
+
+		// Array whose ownership is shared.
+		array_type _array;
+
+		// Pointer to the first element of the subrange.
+		pointer _data;
+
+		// Number of elements in the subrange.
+		size_type _size;
+	};
+
+}
+
+
+#endif
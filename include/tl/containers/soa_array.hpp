@@ -0,0 +1,394 @@
+#ifndef TL_CONTAINERS_SOA_ARRAY_HPP
+#define TL_CONTAINERS_SOA_ARRAY_HPP
+
+
+#include <algorithm>		// std::max
+#include <array>			// std::array
+#include <atomic>			// std::atomic_size_t
+#include <cstddef>			// std::byte, std::size_t
+#include <initializer_list>	// std::initializer_list
+#include <limits>			// std::numeric_limits
+#include <memory>			// std::allocator, std::allocator_traits
+#include <new>				// placement new, std::bad_array_new_length
+#include <tuple>			// std::get, std::tuple, std::tuple_element_t
+#include <utility>			// std::index_sequence, std::index_sequence_for, std::swap
+
+#include <tl/containers/shared_array.hpp>					// tl::containers::detail::decrement_ref_count, increment_ref_count, load_ref_count
+#include <tl/iterators/indexed_zipping_iterator.hpp>		// tl::iterators::indexed_zipping_iterator
+#include <tl/memory/assume_aligned.hpp>						// tl::memory::assume_aligned
+#include <tl/memory/default_construct_n.hpp>				// tl::memory::default_construct_n
+#include <tl/memory/destroy_n.hpp>							// tl::memory::destroy_n
+#include <tl/ranges/iterator_range.hpp>						// tl::ranges::iterator_range
+
+
+namespace tl::containers {
+
+	/* Manages a table of elements stored as a struct of arrays (one column per type in Ts), which is shared between copies of basic_soa_array.
+		All the columns, along with a single reference count, are stored in one allocation. Each column starts at a multiple of
+		column_alignment bytes, so columns can be processed by vector kernels without peeling.
+		Rows are accessed as tuples of references, like the elements of a zipping_adaptor over the columns. Each column is accessible as a
+		contiguous range with column<I>().
+		Distinct basic_soa_array objects sharing a table may be used from different threads.
+		The table is allocated with Allocator (rebound to an internal unit type), and the elements of each column are constructed and destroyed
+		with Allocator rebound to the column's type. Since Allocator cannot follow the column types, basic_soa_array takes it first; soa_array
+		uses std::allocator. */
+	template<class Allocator, typename... Ts>
+	class basic_soa_array {
+	public:
+		/* Member types */
+
+		using value_type = std::tuple<Ts...>;
+		using allocator_type = Allocator;
+		using size_type = std::size_t;
+		using reference = std::tuple<Ts&...>;
+		using const_reference = std::tuple<Ts const&...>;
+		using iterator = iterators::indexed_zipping_iterator<Ts*...>;
+		using const_iterator = iterators::indexed_zipping_iterator<Ts const*...>;
+
+		// Type of the range of elements of the column with index I.
+		template<std::size_t I>
+		using column_type = ranges::iterator_range<std::tuple_element_t<I, std::tuple<Ts...>>*>;
+
+		// Type of the range of const elements of the column with index I.
+		template<std::size_t I>
+		using const_column_type = ranges::iterator_range<std::tuple_element_t<I, std::tuple<Ts...>> const*>;
+
+
+		/* Static variables */
+
+		// Guaranteed alignment, in bytes, of the first element of each column.
+		static constexpr std::size_t column_alignment = std::max({std::size_t{64}, alignof(Ts)...});
+
+
+		/* Special members */
+
+		// If this is the last soa_array object sharing the table, the table is destroyed.
+		~basic_soa_array()
+		{
+			if (_state && detail::decrement_ref_count(_state->refs) == 0) {
+				_destroy_columns(std::index_sequence_for<Ts...>());
+				_deallocate(_alloc, _state);
+			}
+		}
+
+		// Constructs to have no table.
+		basic_soa_array() :
+			_alloc(),
+			_state(),
+			_columns(),
+			_size()
+		{}
+
+		// Constructs to share ownership of other's table.
+		basic_soa_array(basic_soa_array const& other) :
+			_alloc(other._alloc),
+			_state(other._state),
+			_columns(other._columns),
+			_size(other._size)
+		{
+			if (_state) {
+				detail::increment_ref_count(_state->refs);
+			}
+		}
+
+		// Transfers other's table ownership to this.
+		basic_soa_array(basic_soa_array&& other) :
+			basic_soa_array()
+		{
+			swap(*this, other);
+		}
+
+		// Constructs a table with the given number of rows, with default-constructed elements in every column.
+		explicit basic_soa_array(size_type size, Allocator alloc = Allocator()) :
+			_alloc(alloc),
+			_state(_allocate(_alloc, size)),
+			_columns(_column_pointers(_state, size, std::index_sequence_for<Ts...>())),
+			_size(size)
+		{
+			_construct_columns(std::index_sequence_for<Ts...>());
+		}
+
+
+		/* Operators */
+
+		// Releases ownership of current table and shares ownership of rhs's table.
+		basic_soa_array& operator=(basic_soa_array rhs)
+		{
+			swap(*this, rhs);
+
+			return *this;
+		}
+
+		// Gets a tuple of references to the elements of the row at the given index.
+		reference operator[](size_type i)
+		{
+			return begin()[static_cast<typename iterator::difference_type>(i)];
+		}
+
+		// Gets a tuple of const references to the elements of the row at the given index.
+		const_reference operator[](size_type i) const
+		{
+			return cbegin()[static_cast<typename const_iterator::difference_type>(i)];
+		}
+
+
+		/* General functions */
+
+		// Gets an iterator to the first row.
+		iterator begin()
+		{
+			return iterator(_columns, 0);
+		}
+
+		// Gets a const iterator to the first row.
+		const_iterator begin() const
+		{
+			return cbegin();
+		}
+
+		// Gets a const iterator to the first row.
+		const_iterator cbegin() const
+		{
+			return const_iterator(_columns, 0);
+		}
+
+		// Gets a const iterator to one past the last row.
+		const_iterator cend() const
+		{
+			return const_iterator(_columns, static_cast<typename const_iterator::difference_type>(_size));
+		}
+
+		// Gets the contiguous range of elements of the column with index I.
+		template<std::size_t I>
+		column_type<I> column()
+		{
+			auto const data = this->data<I>();
+			return column_type<I>(data, data + _size);
+		}
+
+		// Gets the contiguous range of const elements of the column with index I.
+		template<std::size_t I>
+		const_column_type<I> column() const
+		{
+			auto const data = this->data<I>();
+			return const_column_type<I>(data, data + _size);
+		}
+
+		// Gets a pointer to the first element of the column with index I.
+		template<std::size_t I>
+		std::tuple_element_t<I, std::tuple<Ts...>>* data()
+		{
+			return memory::assume_aligned<column_alignment>(std::get<I>(_columns));
+		}
+
+		// Gets a const pointer to the first element of the column with index I.
+		template<std::size_t I>
+		std::tuple_element_t<I, std::tuple<Ts...>> const* data() const
+		{
+			return memory::assume_aligned<column_alignment>(std::get<I>(_columns));
+		}
+
+		// Gets an iterator to one past the last row.
+		iterator end()
+		{
+			return iterator(_columns, static_cast<typename iterator::difference_type>(_size));
+		}
+
+		// Gets a const iterator to one past the last row.
+		const_iterator end() const
+		{
+			return cend();
+		}
+
+		// Gets the allocator.
+		allocator_type get_allocator() const
+		{
+			return _alloc;
+		}
+
+		// Gets the number of rows.
+		size_type size() const
+		{
+			return _size;
+		}
+
+		// Gets the number of basic_soa_array objects sharing the table, or 0 if there is no table.
+		size_type use_count() const
+		{
+			return _state ? detail::load_ref_count(_state->refs) : 0;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(basic_soa_array& first, basic_soa_array& second)
+		{
+			using std::swap;
+
+			swap(first._alloc, second._alloc);
+			swap(first._state, second._state);
+			swap(first._columns, second._columns);
+			swap(first._size, second._size);
+		}
+
+
+	private:
+		/* Member types */
+
+		// Shared state at the start of the allocation.
+		struct _state_t {
+			// Number of basic_soa_array objects currently sharing the table.
+			std::atomic_size_t refs;
+
+			// Number of rows.
+			size_type size;
+		};
+
+		// Unit in which the allocation is made, such that the allocator provides the required alignment.
+		struct alignas(column_alignment) _unit {
+			unsigned char bytes[column_alignment];
+		};
+
+
+		// Allocator type to be used for allocation of the table.
+		using _unit_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<_unit>;
+
+		// Allocator type to be used for construction and destruction of the elements of the column with index I.
+		template<std::size_t I>
+		using _column_alloc_t = typename std::allocator_traits<Allocator>::template rebind_alloc<std::tuple_element_t<I, std::tuple<Ts...>>>;
+
+
+		/* Static variables */
+
+		// Number of units occupied by the shared state.
+		static constexpr std::size_t _state_units = (sizeof(_state_t) + sizeof(_unit) - 1) / sizeof(_unit);
+
+
+		/* Static functions */
+
+		// Gets the number of units occupied by a column of size elements of type T.
+		template<typename T>
+		static constexpr std::size_t _column_units(size_type size)
+		{
+			return (size * sizeof(T) + sizeof(_unit) - 1) / sizeof(_unit);
+		}
+
+		// Gets the offsets (in units from the start of the allocation) of each column, followed by the total number of units.
+		static constexpr std::array<std::size_t, sizeof...(Ts) + 1> _offsets(size_type size)
+		{
+			std::array<std::size_t, sizeof...(Ts) + 1> offsets{};
+			std::array<std::size_t, sizeof...(Ts)> const units{_column_units<Ts>(size)...};
+			offsets[0] = _state_units;
+			for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+				offsets[i + 1] = offsets[i] + units[i];
+			}
+			return offsets;
+		}
+
+		/* Gets the total number of units for a table of the given size, as _offsets(size)[sizeof...(Ts)], but throws std::bad_array_new_length if
+			the size of any column or of the whole table in bytes is not representable. */
+		static std::size_t _checked_units(size_type size)
+		{
+			constexpr std::size_t max_units = std::numeric_limits<std::size_t>::max() / sizeof(_unit);
+			std::size_t total = _state_units;
+			for (std::size_t const element_size : {sizeof(Ts)...}) {
+				if (size > (max_units - total) * sizeof(_unit) / element_size) {
+					throw std::bad_array_new_length();
+				}
+				total += (size * element_size + sizeof(_unit) - 1) / sizeof(_unit);
+			}
+			return total;
+		}
+
+		/* Allocates storage for the shared state and columns of a table of the given size, and constructs the state with a reference count of 1.
+			Throws std::bad_array_new_length if the size of the storage is not representable. */
+		static _state_t* _allocate(Allocator& alloc, size_type size)
+		{
+			std::size_t const count = _checked_units(size);
+			_unit_alloc_t unit_alloc(alloc);
+			_unit* const units = std::allocator_traits<_unit_alloc_t>::allocate(unit_alloc, count);
+			return ::new(static_cast<void*>(units)) _state_t{1, size};
+		}
+
+		// Deallocates the storage of the given shared state.
+		static void _deallocate(Allocator& alloc, _state_t* state)
+		{
+			_unit_alloc_t unit_alloc(alloc);
+			std::allocator_traits<_unit_alloc_t>::deallocate(unit_alloc, reinterpret_cast<_unit*>(state), _offsets(state->size)[sizeof...(Ts)]);
+		}
+
+		// Gets pointers to the first element of each column of the table with the given shared state and size.
+		template<std::size_t... Idx>
+		static std::tuple<Ts*...> _column_pointers(_state_t* state, size_type size, std::index_sequence<Idx...>)
+		{
+			auto const offsets = _offsets(size);
+			_unit* const units = reinterpret_cast<_unit*>(state);
+			return std::tuple<Ts*...>(reinterpret_cast<Ts*>(units + offsets[Idx])...);
+		}
+
+
+		/* General functions */
+
+		// Default constructs the elements of each column. If any constructor throws, all constructed elements are destroyed and the storage is deallocated.
+		template<std::size_t... Idx>
+		void _construct_columns(std::index_sequence<Idx...>)
+		{
+			std::size_t constructed = 0;
+			try {
+				((_construct_column<Idx>(), ++constructed), ...);
+			}
+			catch (...) {
+				((Idx < constructed ? _destroy_column<Idx>() : void()), ...);
+				_deallocate(_alloc, _state);
+				throw;
+			}
+		}
+
+		// Default constructs the elements of the column with index I.
+		template<std::size_t I>
+		void _construct_column()
+		{
+			_column_alloc_t<I> alloc(_alloc);
+			memory::default_construct_n(alloc, std::get<I>(_columns), _size);
+		}
+
+		// Destroys the elements of each column.
+		template<std::size_t... Idx>
+		void _destroy_columns(std::index_sequence<Idx...>)
+		{
+			(_destroy_column<Idx>(), ...);
+		}
+
+		// Destroys the elements of the column with index I.
+		template<std::size_t I>
+		void _destroy_column()
+		{
+			_column_alloc_t<I> alloc(_alloc);
+			memory::destroy_n(alloc, std::get<I>(_columns), _size);
+		}
+
+
+		/* Variables */
+
+		Allocator _alloc;
+
+		// Pointer to the shared state at the start of the allocation, or null if there is no table.
+		_state_t* _state;
+
+		// Pointers to the first element of each column.
+		std::tuple<Ts*...> _columns;
+
+		// Number of rows.
+		size_type _size;
+	};
+
+
+	// basic_soa_array using std::allocator.
+	template<typename... Ts>
+	using soa_array = basic_soa_array<std::allocator<std::byte>, Ts...>;
+
+}
+
+
+#endif
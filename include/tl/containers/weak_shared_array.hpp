@@ -0,0 +1,146 @@
+#ifndef TL_CONTAINERS_WEAK_SHARED_ARRAY_HPP
+#define TL_CONTAINERS_WEAK_SHARED_ARRAY_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator
+#include <type_traits>		// std::remove_const_t
+#include <utility>			// std::swap
+
+#include <tl/containers/shared_array.hpp>		// tl::containers::shared_array
+
+
+namespace tl::containers {
+
+	/* Refers to an array managed by shared_array without sharing ownership of it.
+		The array is destroyed once all shared_array objects sharing it are destroyed, regardless of any weak_shared_array objects referring to it.
+		While the array still exists, lock() can be used to obtain a shared_array which shares ownership of it.
+		Since the shared state and the array elements are stored in a single allocation, the storage is only deallocated once the array is not
+		referred to by any shared_array or weak_shared_array objects (for arrays in external storage, only the shared state is retained). */
+	template<typename T, bool AtomicRefCount = true, class Allocator = std::allocator<std::remove_const_t<T>>, std::size_t Alignment = alignof(T)>
+	class weak_shared_array {
+	public:
+		/* Member types */
+
+		using array_type = shared_array<T, AtomicRefCount, Allocator, Alignment>;
+		using size_type = typename array_type::size_type;
+		using pointer = typename array_type::pointer;
+
+
+		/* Special members */
+
+		// Releases the reference to the array's storage. Destructs allocator.
+		~weak_shared_array()
+		{
+			if (_state) {
+				array_type::_release_weak(_alloc, _state);
+			}
+		}
+
+		// Constructs to refer to no array and default constructs the allocator.
+		weak_shared_array() :
+			_alloc(),
+			_state(),
+			_data(),
+			_size()
+		{}
+
+		// Constructs to refer to the same array as other, and copy-constructs allocator from other.
+		weak_shared_array(weak_shared_array const& other) :
+			_alloc(other._alloc),
+			_state(other._state),
+			_data(other._data),
+			_size(other._size)
+		{
+			if (_state) {
+				detail::increment_ref_count(_state->weak_refs);
+			}
+		}
+
+		// Transfers other's reference to this, and move-constructs allocator from other.
+		weak_shared_array(weak_shared_array&& other) :
+			weak_shared_array()
+		{
+			swap(*this, other);
+		}
+
+		// Constructs to refer to the array owned by array (if any), and copy-constructs allocator from array.
+		weak_shared_array(array_type const& array) :
+			_alloc(array._alloc),
+			_state(array._state),
+			_data(array._data),
+			_size(array._size)
+		{
+			if (_state) {
+				detail::increment_ref_count(_state->weak_refs);
+			}
+		}
+
+
+		/* Operators */
+
+		// Releases the reference to the current array, refers to the array referred to by rhs, and copy/move-assigns allocator from rhs.
+		weak_shared_array& operator=(weak_shared_array rhs)
+		{
+			swap(*this, rhs);
+
+			return *this;
+		}
+
+
+		/* General functions */
+
+		// Returns true if the array referred to has been destroyed (or if no array is referred to), otherwise false.
+		bool expired() const
+		{
+			return !_state || detail::load_ref_count(_state->refs) == 0;
+		}
+
+		/* If the array referred to has not been destroyed, returns a shared_array which shares ownership of it.
+			Otherwise, returns a shared_array with no array. */
+		array_type lock() const
+		{
+			if (_state && detail::increment_if_nonzero(_state->refs)) {
+				return array_type(typename array_type::_adopt_tag(), _alloc, _state, _data, _size);
+			}
+			else {
+				return array_type();
+			}
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the contents of first and second.
+		friend void swap(weak_shared_array& first, weak_shared_array& second)
+		{
+			using std::swap;
+
+			swap(first._alloc, second._alloc);
+			swap(first._state, second._state);
+			swap(first._data, second._data);
+			swap(first._size, second._size);
+		}
+
+
+	private:
+		/* Variables */
+
+		/* Allocator to use for deallocation.
+			Mutable because const-qualified allocators aren't required to be useful. */
+		mutable Allocator _alloc;
+
+		// Pointer to the shared array state.
+		typename array_type::_state_t* _state;
+
+		// Pointer to the first element of the array.
+		pointer _data;
+
+		// Number of elements in the array.
+		size_type _size;
+	};
+
+}
+
+
+#endif
@@ -0,0 +1,131 @@
+#ifndef TL_EXECUTION_POOL_POLICY_HPP
+#define TL_EXECUTION_POOL_POLICY_HPP
+
+
+#include <algorithm>		// std::max
+#include <cstddef>			// std::size_t
+#include <type_traits>		// std::false_type, std::true_type
+
+#include <tl/execution/thread_pool.hpp>		// tl::execution::thread_pool
+
+
+namespace tl::execution {
+
+	/* Execution policy which runs the parallel algorithms of tl::ranges on a thread_pool.
+		By default, the range is divided into chunks of at least grain elements each, and at most chunks_per_thread chunks for each thread (the
+		workers and the calling thread), so that work stealing can balance uneven chunks. Ranges of fewer than twice grain elements are processed
+		sequentially on the calling thread. Chunks may run on any thread, so successive algorithms over the same range do not necessarily access
+		the same elements from the same thread.
+		A policy created with pinned() instead divides the range into one chunk per worker, with execution::static_partition, and always runs
+		chunk i on worker i. Successive algorithms over a range of the same size then access each element from the same thread (and CPU, if the
+		pool's workers are pinned), matching the placement of memory::parallel_default_construct_n with the same pool, at the cost of load
+		balancing. As in the default mode, a range which forms a single chunk is processed on the calling thread.
+		The range's iterators must be random access.
+		Unlike the standard execution policies, the threads, their CPUs and the chunk sizes are under the caller's control, and no TBB is
+		required. */
+	class pool_policy {
+	public:
+		/* Static variables */
+
+		// Default minimum number of elements in each chunk.
+		static constexpr std::size_t default_grain = 1024;
+
+		// Maximum number of chunks per thread.
+		static constexpr std::size_t chunks_per_thread = 4;
+
+
+		/* Special members */
+
+		// Constructs to run on thread_pool::default_pool(), with the default grain size.
+		pool_policy() :
+			pool_policy(thread_pool::default_pool())
+		{}
+
+		// Constructs to run on the given pool, with chunks of at least grain elements.
+		explicit pool_policy(thread_pool& pool, std::size_t grain = default_grain) :
+			_pool(&pool),
+			_grain(std::max<std::size_t>(grain, 1)),
+			_pinned(false)
+		{}
+
+
+		/* General functions */
+
+		// Gets the minimum number of elements in each chunk.
+		std::size_t grain() const
+		{
+			return _grain;
+		}
+
+		// Gets whether each chunk always runs on the worker with the same index.
+		bool is_pinned() const
+		{
+			return _pinned;
+		}
+
+		// Gets the maximum number of chunks into which a range is divided.
+		std::size_t max_chunks() const
+		{
+			return _pinned ? std::max<std::size_t>(_pool->size(), 1) : chunks_per_thread * (_pool->size() + 1);
+		}
+
+		// Gets the pool on which algorithms run.
+		thread_pool& pool() const
+		{
+			return *_pool;
+		}
+
+		// Calls f(i) for each chunk index i in [0, count) on the pool, with thread_pool::run_pinned if pinned, otherwise thread_pool::run.
+		template<typename Function>
+		void run(std::size_t count, Function f) const
+		{
+			if (_pinned) {
+				_pool->run_pinned(count, f);
+			}
+			else {
+				_pool->run(count, f);
+			}
+		}
+
+
+		/* Static functions */
+
+		// Creates a policy which runs on the given pool, dividing ranges into one chunk per worker, each always run by the same worker.
+		static pool_policy pinned(thread_pool& pool)
+		{
+			pool_policy policy(pool, 1);
+			policy._pinned = true;
+			return policy;
+		}
+
+
+	private:
+		/* Variables */
+
+		thread_pool* _pool;
+
+		// Minimum number of elements in each chunk.
+		std::size_t _grain;
+
+		// Whether each chunk always runs on the worker with the same index.
+		bool _pinned;
+	};
+
+
+	// Matches if T is not pool_policy.
+	template<typename T>
+	struct is_pool_policy : std::false_type {};
+
+
+	// Matches if T is pool_policy.
+	template<>
+	struct is_pool_policy<pool_policy> : std::true_type {};
+
+
+	template<typename T>
+	inline constexpr bool is_pool_policy_v = is_pool_policy<T>::value;
+
+}
+
+
+#endif
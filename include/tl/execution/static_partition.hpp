@@ -0,0 +1,31 @@
+#ifndef TL_EXECUTION_STATIC_PARTITION_HPP
+#define TL_EXECUTION_STATIC_PARTITION_HPP
+
+
+#include <cstddef>			// std::size_t
+
+
+namespace tl::execution {
+
+	// Half-open range of indices [first, last).
+	struct index_range {
+		std::size_t first;
+		std::size_t last;
+	};
+
+
+	/* Gets the range of indices of the part with the given index, when count elements are divided into parts contiguous parts.
+		The parts differ in size by at most 1, with the larger parts first. This is the partitioning used wherever work over an array is divided
+		statically between threads, so that the same thread index always touches the same elements (eg. for NUMA first-touch placement). */
+	constexpr index_range static_partition(std::size_t count, std::size_t parts, std::size_t index)
+	{
+		std::size_t const quotient = count / parts;
+		std::size_t const remainder = count % parts;
+		std::size_t const first = index * quotient + (index < remainder ? index : remainder);
+		return {first, first + quotient + (index < remainder ? 1 : 0)};
+	}
+
+}
+
+
+#endif
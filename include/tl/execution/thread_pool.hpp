@@ -0,0 +1,429 @@
+#ifndef TL_EXECUTION_THREAD_POOL_HPP
+#define TL_EXECUTION_THREAD_POOL_HPP
+
+
+#include <atomic>				// std::atomic_size_t, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>				// std::size_t
+#include <deque>				// std::deque
+#include <exception>			// std::current_exception, std::exception_ptr, std::rethrow_exception
+#include <functional>			// std::function
+#include <memory>				// std::make_unique, std::unique_ptr
+#include <mutex>				// std::lock_guard, std::mutex, std::unique_lock
+#include <optional>				// std::optional
+#include <thread>				// std::thread
+#include <utility>				// std::move
+#include <vector>				// std::vector
+
+#ifdef __linux__
+#include <pthread.h>			// pthread_setaffinity_np
+#include <sched.h>				// cpu_set_t, CPU_SET, CPU_SETSIZE, CPU_ZERO
+#endif
+
+
+namespace tl::execution {
+
+	/* Persistent pool of worker threads which execute tasks, balancing load by work stealing.
+		Each worker has its own deque of tasks. A worker pushes and pops tasks at the back of its own deque (so recently created, cache-warm tasks
+		run first), and when it runs out, steals from the front of the other workers' deques. Tasks submitted from outside the pool are
+		distributed over the workers' deques in turn. Idle workers sleep until tasks are submitted.
+		Workers are created once, when the pool is constructed, and reused by every call, so there is no per-call thread creation cost.
+		Workers may be pinned to a given set of CPUs (only on Linux; elsewhere the CPUs are ignored). With run_pinned, tasks may also be bound to
+		a worker, so that the same index always runs on the same thread (eg. to keep accessing memory placed by first touch). */
+	class thread_pool {
+	public:
+		/* Special members */
+
+		// Runs all remaining tasks, then stops and joins the workers.
+		~thread_pool()
+		{
+			_stop();
+		}
+
+		// Constructs with the given number of workers, which are not pinned to CPUs.
+		explicit thread_pool(std::size_t threads) :
+			_workers(),
+			_sleep_mutex(),
+			_wake(),
+			_pending(0),
+			_next(0),
+			_stopping(false)
+		{
+			_start(std::vector<std::optional<std::size_t>>(threads));
+		}
+
+		// Constructs with one worker per CPU in cpus, each pinned to its CPU.
+		explicit thread_pool(std::vector<std::size_t> const& cpus) :
+			_workers(),
+			_sleep_mutex(),
+			_wake(),
+			_pending(0),
+			_next(0),
+			_stopping(false)
+		{
+			_start(std::vector<std::optional<std::size_t>>(cpus.begin(), cpus.end()));
+		}
+
+		thread_pool(thread_pool const& other) = delete;
+
+
+		/* Operators */
+
+		thread_pool& operator=(thread_pool const& rhs) = delete;
+
+
+		/* General functions */
+
+		/* Calls f(i) for each i in [0, count) as separate tasks, and waits for them all to complete.
+			The calling thread runs tasks of the pool while it waits, so run may be called from within a task without deadlock, and a pool with no
+			workers runs everything on the calling thread. If any call throws, the remaining calls still run, then one of the exceptions is
+			rethrown. If a task cannot be submitted (eg. due to std::bad_alloc), the remaining calls are made on the calling thread instead. */
+		template<typename Function>
+		void run(std::size_t count, Function f)
+		{
+			_run(count, f, false);
+		}
+
+		/* Calls f(i) for each i in [0, count) on the worker with index i, and waits for them all to complete. count must be at most size(),
+			unless the pool has no workers, in which case everything runs on the calling thread.
+			These tasks are never stolen, so every call with the same index runs on the same thread (and CPU, if the workers are pinned).
+			Otherwise behaves like run. */
+		template<typename Function>
+		void run_pinned(std::size_t count, Function f)
+		{
+			_run(count, f, true);
+		}
+
+		// Gets the number of workers.
+		std::size_t size() const
+		{
+			return _workers.size();
+		}
+
+		/* Submits a task, to be run by a worker at some point before the pool is destroyed. f must not throw.
+			If the calling thread is a worker of this pool, the task is pushed to its own deque. If the pool has no workers, f is called
+			immediately. If the task cannot be stored, the exception propagates and the task is not run. */
+		template<typename Function>
+		void submit(Function f)
+		{
+			if (_workers.empty()) {
+				f();
+				return;
+			}
+
+			_identity const& self = _this_thread();
+			_worker& worker = self.pool == this ? *_workers[self.index] : *_workers[_next.fetch_add(1, std::memory_order_relaxed) % _workers.size()];
+			// Counted before it is pushed, so that the count never drops below the number of tasks in the deques.
+			_pending.fetch_add(1, std::memory_order_relaxed);
+			try {
+				std::lock_guard<std::mutex> lock(worker.mutex);
+				worker.tasks.emplace_back(std::move(f));
+			}
+			catch (...) {
+				_pending.fetch_sub(1, std::memory_order_relaxed);
+				throw;
+			}
+			{
+				std::lock_guard<std::mutex> lock(_sleep_mutex);
+			}
+			_wake.notify_one();
+		}
+
+
+		/* Static functions */
+
+		/* Gets the pool shared by default by the program, which is created on first use with one fewer worker than the number of hardware
+			threads (since the thread calling run also works). */
+		static thread_pool& default_pool()
+		{
+			static thread_pool pool(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+			return pool;
+		}
+
+
+	private:
+		/* Member types */
+
+		// A worker thread and its deques of tasks.
+		struct _worker {
+			// Guards tasks and pinned.
+			std::mutex mutex;
+
+			// Tasks; the owner works at the back, thieves take from the front.
+			std::deque<std::function<void()>> tasks;
+
+			// Tasks which only the owner may run, in submission order.
+			std::deque<std::function<void()>> pinned;
+
+			// Number of pinned tasks submitted but not yet taken.
+			std::atomic_size_t pinned_pending;
+
+			std::thread thread;
+		};
+
+		// Identifies the pool and worker index of a worker thread.
+		struct _identity {
+			thread_pool const* pool;
+			std::size_t index;
+		};
+
+
+		/* Static functions */
+
+		// Gets the identity of the calling thread, whose pool is null if it is not a worker.
+		static _identity& _this_thread()
+		{
+			static thread_local _identity identity{nullptr, 0};
+			return identity;
+		}
+
+		// Pins the calling thread to the given CPU, if supported. Pinning is only a hint, so failure is not an error.
+		static void _pin([[maybe_unused]] std::size_t cpu)
+		{
+#ifdef __linux__
+			if (cpu < CPU_SETSIZE) {
+				cpu_set_t set;
+				CPU_ZERO(&set);
+				CPU_SET(cpu, &set);
+				::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+			}
+#endif
+		}
+
+
+		/* General functions */
+
+		// Creates a worker for each element of cpus, pinned to the CPU if there is one. If a worker cannot be created, the others are stopped.
+		void _start(std::vector<std::optional<std::size_t>> const& cpus)
+		{
+			_workers.reserve(cpus.size());
+			for (std::size_t i = 0; i < cpus.size(); ++i) {
+				_workers.push_back(std::make_unique<_worker>());
+			}
+			try {
+				for (std::size_t i = 0; i < cpus.size(); ++i) {
+					_workers[i]->thread = std::thread([this, i, cpu = cpus[i]] {
+						if (cpu) {
+							_pin(*cpu);
+						}
+						_work(i);
+					});
+				}
+			}
+			catch (...) {
+				_stop();
+				throw;
+			}
+		}
+
+		// Wakes the workers, waits for them to run all remaining tasks and exit.
+		void _stop()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_sleep_mutex);
+				_stopping = true;
+			}
+			_wake.notify_all();
+			for (std::unique_ptr<_worker> const& worker : _workers) {
+				if (worker->thread.joinable()) {
+					worker->thread.join();
+				}
+			}
+		}
+
+		/* Calls f(i) for each i in [0, count) as tasks, and waits for them all to complete (see run and run_pinned). If pinned, call i runs on
+			worker i; otherwise call 0 runs on the calling thread and the others are submitted normally. */
+		template<typename Function>
+		void _run(std::size_t count, Function& f, bool pinned)
+		{
+			if (count == 0) {
+				return;
+			}
+			if (_workers.empty()) {
+				pinned = false;
+			}
+
+			std::atomic_size_t remaining(count);
+			std::mutex error_mutex;
+			std::exception_ptr error;
+			auto call = [&](std::size_t i) {
+				thread_pool& pool = *this;
+				try {
+					f(i);
+				}
+				catch (...) {
+					std::lock_guard<std::mutex> lock(error_mutex);
+					error = std::current_exception();
+				}
+				// Must be the last access to this frame, since the waiting thread may return as soon as it sees remaining reach 0.
+				if (remaining.fetch_sub(1, std::memory_order_release) == 1) {
+					pool._notify_all();
+				}
+			};
+
+			// Submitted tasks refer to this frame, so even if submission fails, every call must complete before returning.
+			std::size_t i = pinned ? 0 : 1;
+			try {
+				for (; i < count; ++i) {
+					if (pinned) {
+						_submit_pinned(i, [&call, i] { call(i); });
+					}
+					else {
+						submit([&call, i] { call(i); });
+					}
+				}
+			}
+			catch (...) {
+				for (; i < count; ++i) {
+					call(i);
+				}
+			}
+			if (!pinned) {
+				call(0);
+			}
+
+			/* Runs tasks while waiting. When there are none, sleeps until the last call completes or a task which this thread could run (including
+				one pinned to it, if it is a worker) is submitted. */
+			_identity const& self = _this_thread();
+			std::size_t const index = self.pool == this ? self.index : _workers.size();
+			while (remaining.load(std::memory_order_acquire) != 0) {
+				if (!_run_one()) {
+					std::unique_lock<std::mutex> lock(_sleep_mutex);
+					_wake.wait(lock, [this, &remaining, index] {
+						return remaining.load(std::memory_order_acquire) == 0 || _has_work(index);
+					});
+				}
+			}
+
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+
+		// Submits a task which only the worker with the given index may run. f must not throw.
+		template<typename Function>
+		void _submit_pinned(std::size_t index, Function f)
+		{
+			_worker& worker = *_workers[index];
+			worker.pinned_pending.fetch_add(1, std::memory_order_relaxed);
+			try {
+				std::lock_guard<std::mutex> lock(worker.mutex);
+				worker.pinned.emplace_back(std::move(f));
+			}
+			catch (...) {
+				worker.pinned_pending.fetch_sub(1, std::memory_order_relaxed);
+				throw;
+			}
+			// A particular worker cannot be woken, so all are woken and the others go back to sleep.
+			_notify_all();
+		}
+
+		// Wakes all sleeping workers and threads waiting in run.
+		void _notify_all()
+		{
+			{
+				std::lock_guard<std::mutex> lock(_sleep_mutex);
+			}
+			_wake.notify_all();
+		}
+
+		// Returns true if there may be a task which the worker with the given index (or any other thread, if it is not a valid index) can take.
+		bool _has_work(std::size_t index) const
+		{
+			return _pending.load(std::memory_order_relaxed) != 0
+				|| (index < _workers.size() && _workers[index]->pinned_pending.load(std::memory_order_relaxed) != 0);
+		}
+
+		// Main loop of the worker with the given index.
+		void _work(std::size_t index)
+		{
+			_this_thread() = _identity{this, index};
+
+			while (true) {
+				if (std::optional<std::function<void()>> task = _take(index)) {
+					(*task)();
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lock(_sleep_mutex);
+				_wake.wait(lock, [this, index] { return _stopping || _has_work(index); });
+				if (_stopping && !_has_work(index)) {
+					return;
+				}
+			}
+		}
+
+		/* Takes a pinned task or a task from the back of the deque of the worker with the given index (if it is a valid index), otherwise
+			steals one from the front of another worker's deque. Returns an empty optional if no task was found. */
+		std::optional<std::function<void()>> _take(std::size_t index)
+		{
+			std::size_t const count = _workers.size();
+			if (index < count) {
+				_worker& own = *_workers[index];
+				std::lock_guard<std::mutex> lock(own.mutex);
+				if (!own.pinned.empty()) {
+					std::function<void()> task = std::move(own.pinned.front());
+					own.pinned.pop_front();
+					own.pinned_pending.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+				if (!own.tasks.empty()) {
+					std::function<void()> task = std::move(own.tasks.back());
+					own.tasks.pop_back();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+			}
+
+			std::size_t const start = index < count ? index + 1 : 0;
+			for (std::size_t i = 0; i < count; ++i) {
+				_worker& victim = *_workers[(start + i) % count];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+				if (!victim.tasks.empty()) {
+					std::function<void()> task = std::move(victim.tasks.front());
+					victim.tasks.pop_front();
+					_pending.fetch_sub(1, std::memory_order_relaxed);
+					return task;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		// Runs one task on the calling thread, preferring its own deques if it is a worker of this pool. Returns false if there was no task.
+		bool _run_one()
+		{
+			_identity const& self = _this_thread();
+			if (std::optional<std::function<void()>> task = _take(self.pool == this ? self.index : _workers.size())) {
+				(*task)();
+				return true;
+			}
+			return false;
+		}
+
+
+		/* Variables */
+
+		// Workers, which are never added or removed after construction.
+		std::vector<std::unique_ptr<_worker>> _workers;
+
+		// Guards _stopping, and orders submissions and completions of run with the sleep of idle workers and waiting threads.
+		std::mutex _sleep_mutex;
+
+		// Notified when tasks are submitted, when the last call of a run completes, or when the pool stops.
+		std::condition_variable _wake;
+
+		// Number of unpinned tasks submitted but not yet taken.
+		std::atomic_size_t _pending;
+
+		// Index of the worker to receive the next task submitted from outside the pool.
+		std::atomic_size_t _next;
+
+		// Whether the pool is being destroyed.
+		bool _stopping;
+	};
+
+}
+
+
+#endif
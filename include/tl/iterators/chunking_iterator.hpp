@@ -0,0 +1,251 @@
+#ifndef TL_ITERATORS_CHUNKING_ITERATOR_HPP
+#define TL_ITERATORS_CHUNKING_ITERATOR_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <iterator>			// std::iterator_traits, std::random_access_iterator_tag
+
+#include <tl/execution/static_partition.hpp>		// tl::execution::index_range, tl::execution::static_partition
+#include <tl/ranges/iterator_range.hpp>				// tl::ranges::iterator_range
+
+
+namespace tl::iterators {
+
+	/* Iterator over the chunks of a range, where the range is divided into a given number of contiguous chunks with
+		execution::static_partition. Dereferences to an iterator_range of the chunk's elements.
+		The base iterator must be a random access iterator, so that each chunk is obtained in constant time.
+		Iterators are only comparable if they refer to the same division of the same range. */
+	template<typename Iterator>
+	class chunking_iterator {
+	public:
+		/* Member types */
+
+		using value_type = ranges::iterator_range<Iterator>;
+		using reference = value_type;
+		using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+		using iterator_category = std::random_access_iterator_tag;
+
+
+		/* Special members */
+
+		// Destructs the base iterator.
+		~chunking_iterator() = default;
+
+		// Value-initializes the base iterator, sizes and index.
+		chunking_iterator() :
+			_base(),
+			_size(),
+			_chunks(),
+			_index()
+		{}
+
+		// Copy-constructs the base iterator, sizes and index from those of other.
+		chunking_iterator(chunking_iterator const& other) = default;
+
+		// Move-constructs the base iterator, sizes and index from those of other.
+		chunking_iterator(chunking_iterator&& other) = default;
+
+		/* Constructs to refer to the chunk with the given index, when the size elements starting at base are divided into the given number of
+			chunks. */
+		chunking_iterator(Iterator base, std::size_t size, std::size_t chunks, difference_type index) :
+			_base(base),
+			_size(size),
+			_chunks(chunks),
+			_index(index)
+		{}
+
+
+		/* Operators */
+
+		// Copy-assigns the base iterator, sizes and index from those of rhs.
+		chunking_iterator& operator=(chunking_iterator const& rhs) = default;
+
+		// Move-assigns the base iterator, sizes and index from those of rhs.
+		chunking_iterator& operator=(chunking_iterator&& rhs) = default;
+
+		// Advances by n chunks.
+		chunking_iterator& operator+=(difference_type n)
+		{
+			_index += n;
+
+			return *this;
+		}
+
+		// Advances by -n chunks.
+		chunking_iterator& operator-=(difference_type n)
+		{
+			_index -= n;
+
+			return *this;
+		}
+
+		// Gets the range of elements of the current chunk.
+		reference operator*() const
+		{
+			return operator[](0);
+		}
+
+		// Gets the range of elements of the chunk at an offset of n.
+		reference operator[](difference_type n) const
+		{
+			execution::index_range const part = execution::static_partition(_size, _chunks, static_cast<std::size_t>(_index + n));
+			return reference(_base + static_cast<difference_type>(part.first), _base + static_cast<difference_type>(part.last));
+		}
+
+		// Advances to the next chunk, then returns the new state.
+		chunking_iterator& operator++()
+		{
+			++_index;
+
+			return *this;
+		}
+
+		// Advances to the next chunk, then returns the previous state.
+		chunking_iterator operator++(int)
+		{
+			auto tmp = *this;
+
+			operator++();
+
+			return tmp;
+		}
+
+		// Moves to the previous chunk, then returns the new state.
+		chunking_iterator& operator--()
+		{
+			--_index;
+
+			return *this;
+		}
+
+		// Moves to the previous chunk, then returns the previous state.
+		chunking_iterator operator--(int)
+		{
+			auto tmp = *this;
+
+			operator--();
+
+			return tmp;
+		}
+
+
+		/* General functions */
+
+		// Gets the index of the current chunk.
+		difference_type index() const
+		{
+			return _index;
+		}
+
+
+	private:
+		/* Variables */
+
+		// Iterator to the first element of the divided range.
+		Iterator _base;
+
+		// Number of elements in the divided range.
+		std::size_t _size;
+
+		// Number of chunks the range is divided into.
+		std::size_t _chunks;
+
+		// Index of the current chunk.
+		difference_type _index;
+	};
+
+
+	// Returns a copy of lhs advanced by rhs chunks.
+	template<typename Iterator>
+	chunking_iterator<Iterator> operator+(chunking_iterator<Iterator> const& lhs, typename chunking_iterator<Iterator>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp += rhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of rhs advanced by lhs chunks.
+	template<typename Iterator>
+	chunking_iterator<Iterator> operator+(typename chunking_iterator<Iterator>::difference_type lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		auto tmp = rhs;
+		tmp += lhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of lhs advanced by -rhs chunks.
+	template<typename Iterator>
+	chunking_iterator<Iterator> operator-(chunking_iterator<Iterator> const& lhs, typename chunking_iterator<Iterator>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp -= rhs;
+
+		return tmp;
+	}
+
+	// Returns the number of chunks between rhs and lhs.
+	template<typename Iterator>
+	auto operator-(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return lhs.index() - rhs.index();
+	}
+
+	// lhs and rhs are considered equal if they refer to the same chunk.
+	template<typename Iterator>
+	bool operator==(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return lhs.index() == rhs.index();
+	}
+
+	// lhs and rhs are considered unequal if they refer to different chunks.
+	template<typename Iterator>
+	bool operator!=(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	// lhs is considered less than rhs if it refers to an earlier chunk.
+	template<typename Iterator>
+	bool operator<(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return lhs.index() < rhs.index();
+	}
+
+	// lhs is considered less than or equal to rhs if it refers to the same or an earlier chunk.
+	template<typename Iterator>
+	bool operator<=(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return !(lhs > rhs);
+	}
+
+	// lhs is considered greater than rhs if it refers to a later chunk.
+	template<typename Iterator>
+	bool operator>(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	// lhs is considered greater than or equal to rhs if it refers to the same or a later chunk.
+	template<typename Iterator>
+	bool operator>=(chunking_iterator<Iterator> const& lhs, chunking_iterator<Iterator> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+}
+
+
+// Specialization for tl::iterators::chunking_iterator.
+template<typename Iterator>
+struct std::iterator_traits<tl::iterators::chunking_iterator<Iterator>> {
+	using value_type = typename tl::iterators::chunking_iterator<Iterator>::value_type;
+	using reference = typename tl::iterators::chunking_iterator<Iterator>::reference;
+	using pointer = void;
+	using difference_type = typename tl::iterators::chunking_iterator<Iterator>::difference_type;
+	using iterator_category = typename tl::iterators::chunking_iterator<Iterator>::iterator_category;
+};
+
+
+#endif
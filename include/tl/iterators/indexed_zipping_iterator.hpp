@@ -0,0 +1,256 @@
+#ifndef TL_ITERATORS_INDEXED_ZIPPING_ITERATOR_HPP
+#define TL_ITERATORS_INDEXED_ZIPPING_ITERATOR_HPP
+
+
+#include <iterator>			// std::iterator_traits, std::random_access_iterator_tag
+#include <tuple>			// std::tuple
+#include <type_traits>		// std::common_type_t
+
+#include <tl/tuple/transform.hpp>	// tl::tuple::transform
+
+
+namespace tl::iterators {
+
+	/* Iterator adaptor that iterates multiple random access iterators simultaneously, and dereferences to a tuple of the results of
+		dereferencing each iterator.
+		Unlike zipping_iterator, the base iterators are never modified. Instead, a single index is stored, which is the offset from each base
+		iterator. Incrementing, comparing and subtracting iterators only operate on the index, so iterating a zipped range (whose end is known,
+		eg. from the smallest size of the ranges) compiles to the same code as a hand-written indexed loop.
+		Iterators are only comparable if they have the same base iterators. */
+	template<typename... Iterators>
+	class indexed_zipping_iterator {
+	public:
+		/* Member types */
+
+		using value_type = std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+		using reference = std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+		using difference_type = std::common_type_t<typename std::iterator_traits<Iterators>::difference_type...>;
+		using iterator_category = std::random_access_iterator_tag;
+
+
+		/* Special members */
+
+		// Destructs the base iterators.
+		~indexed_zipping_iterator() = default;
+
+		// Value-initializes the base iterators and the index.
+		indexed_zipping_iterator() :
+			_bases(),
+			_index()
+		{}
+
+		// Copy-constructs the base iterators and the index from those of other.
+		indexed_zipping_iterator(indexed_zipping_iterator const& other) = default;
+
+		// Move-constructs the base iterators and the index from those of other.
+		indexed_zipping_iterator(indexed_zipping_iterator&& other) = default;
+
+		// Constructs the base iterators from a tuple of iterators, and the index from the given value.
+		indexed_zipping_iterator(std::tuple<Iterators...> bases, difference_type index) :
+			_bases(bases),
+			_index(index)
+		{}
+
+
+		/* Operators */
+
+		// Copy-assigns the base iterators and the index from those of rhs.
+		indexed_zipping_iterator& operator=(indexed_zipping_iterator const& rhs) = default;
+
+		// Move-assigns the base iterators and the index from those of rhs.
+		indexed_zipping_iterator& operator=(indexed_zipping_iterator&& rhs) = default;
+
+		// Advances the index by n.
+		indexed_zipping_iterator& operator+=(difference_type n)
+		{
+			_index += n;
+
+			return *this;
+		}
+
+		// Advances the index by -n.
+		indexed_zipping_iterator& operator-=(difference_type n)
+		{
+			_index -= n;
+
+			return *this;
+		}
+
+		// Returns a tuple containing the results of dereferencing each base iterator at an offset of the index.
+		reference operator*() const
+		{
+			return operator[](0);
+		}
+
+		// Returns a tuple containing the results of dereferencing each base iterator at an offset of the index plus n.
+		reference operator[](difference_type n) const
+		{
+			difference_type const i = _index + n;
+			return tuple::transform(_bases, [i](auto const& it) -> decltype(auto) {
+					return it[i];
+				});
+		}
+
+		// Increments the index, then returns the new state.
+		indexed_zipping_iterator& operator++()
+		{
+			++_index;
+
+			return *this;
+		}
+
+		// Increments the index, then returns the previous state.
+		indexed_zipping_iterator operator++(int)
+		{
+			auto tmp = *this;
+
+			operator++();
+
+			return tmp;
+		}
+
+		// Decrements the index, then returns the new state.
+		indexed_zipping_iterator& operator--()
+		{
+			--_index;
+
+			return *this;
+		}
+
+		// Decrements the index, then returns the previous state.
+		indexed_zipping_iterator operator--(int)
+		{
+			auto tmp = *this;
+
+			operator--();
+
+			return tmp;
+		}
+
+
+		/* General functions */
+
+		// Gets a tuple of the base iterators advanced by the index.
+		std::tuple<Iterators...> base() const
+		{
+			difference_type const i = _index;
+			return tuple::transform(_bases, [i](auto const& it) {
+					return it + i;
+				});
+		}
+
+		// Gets the index, ie. the offset from the base iterators.
+		difference_type index() const
+		{
+			return _index;
+		}
+
+
+	private:
+		/* Variables */
+
+		// Iterators from which the index is an offset.
+		std::tuple<Iterators...> _bases;
+
+		// Offset from the base iterators.
+		difference_type _index;
+	};
+
+
+	// Returns a copy of lhs advanced by rhs.
+	template<typename... Iterators>
+	indexed_zipping_iterator<Iterators...> operator+(indexed_zipping_iterator<Iterators...> const& lhs,
+		typename indexed_zipping_iterator<Iterators...>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp += rhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of rhs advanced by lhs.
+	template<typename... Iterators>
+	indexed_zipping_iterator<Iterators...> operator+(typename indexed_zipping_iterator<Iterators...>::difference_type lhs,
+		indexed_zipping_iterator<Iterators...> const& rhs)
+	{
+		auto tmp = rhs;
+		tmp += lhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of lhs advanced by -rhs.
+	template<typename... Iterators>
+	indexed_zipping_iterator<Iterators...> operator-(indexed_zipping_iterator<Iterators...> const& lhs,
+		typename indexed_zipping_iterator<Iterators...>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp -= rhs;
+
+		return tmp;
+	}
+
+	// Returns the difference between the indices of lhs and rhs.
+	template<typename... Iterators1, typename... Iterators2>
+	auto operator-(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return lhs.index() - rhs.index();
+	}
+
+	// lhs and rhs are considered equal if their indices are equal.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator==(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return lhs.index() == rhs.index();
+	}
+
+	// lhs and rhs are considered unequal if their indices are unequal.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator!=(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+	// lhs is considered less than rhs if the index of lhs is less than that of rhs.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator<(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return lhs.index() < rhs.index();
+	}
+
+	// lhs is considered less than or equal to rhs if the index of lhs is less than or equal to that of rhs.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator<=(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return !(lhs > rhs);
+	}
+
+	// lhs is considered greater than rhs if the index of lhs is greater than that of rhs.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator>(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return rhs < lhs;
+	}
+
+	// lhs is considered greater than or equal to rhs if the index of lhs is greater than or equal to that of rhs.
+	template<typename... Iterators1, typename... Iterators2>
+	bool operator>=(indexed_zipping_iterator<Iterators1...> const& lhs, indexed_zipping_iterator<Iterators2...> const& rhs)
+	{
+		return !(lhs < rhs);
+	}
+
+}
+
+
+// Specialization for tl::iterators::indexed_zipping_iterator.
+template<typename... Iterators>
+struct std::iterator_traits<tl::iterators::indexed_zipping_iterator<Iterators...>> {
+	using value_type = typename tl::iterators::indexed_zipping_iterator<Iterators...>::value_type;
+	using reference = typename tl::iterators::indexed_zipping_iterator<Iterators...>::reference;
+	using pointer = void;
+	using difference_type = typename tl::iterators::indexed_zipping_iterator<Iterators...>::difference_type;
+	using iterator_category = typename tl::iterators::indexed_zipping_iterator<Iterators...>::iterator_category;
+};
+
+
+#endif
@@ -0,0 +1,329 @@
+#ifndef TL_ITERATORS_SWAPPABLE_ITERATOR_HPP
+#define TL_ITERATORS_SWAPPABLE_ITERATOR_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <iterator>			// std::iterator_traits
+#include <tuple>			// std::get, std::tuple, std::tuple_element, std::tuple_size, std::tuple_size_v
+#include <utility>			// std::index_sequence, std::make_index_sequence, std::move
+
+
+namespace tl::iterators {
+
+	/* Proxy reference which behaves as Reference (a tuple of references returned by value from dereferencing an iterator, eg. by
+		zipping_iterator), but can also be swapped when it is an rvalue, through a swap function found by ADL. Value is the value type of the
+		iterator (a tuple of the referenced types).
+		Unlike Reference, an rvalue swappable_reference moves the referenced elements, when converted to Value or assigned to another
+		swappable_reference. This allows std algorithms which move and swap elements (eg. std::sort, which swaps through std::iter_swap) to be
+		used with such iterators, including for elements which can only be moved. */
+	template<typename Reference, typename Value>
+	class swappable_reference : public Reference {
+	public:
+		/* Special members */
+
+		// Constructs the reference from the given value.
+		swappable_reference(Reference ref) :
+			Reference(std::move(ref))
+		{}
+
+		// Copy-constructs the references from those of other.
+		swappable_reference(swappable_reference const& other) = default;
+
+		// Move-constructs the references from those of other.
+		swappable_reference(swappable_reference&& other) = default;
+
+
+		/* Operators */
+
+		// Assigns through the reference, as Reference does (moving the elements of an rvalue tuple).
+		using Reference::operator=;
+
+		// Copy-assigns each referenced element from the corresponding element referenced by rhs.
+		swappable_reference& operator=(swappable_reference const& rhs)
+		{
+			Reference::operator=(rhs);
+
+			return *this;
+		}
+
+		// Move-assigns each referenced element from the corresponding element referenced by rhs.
+		swappable_reference& operator=(swappable_reference&& rhs)
+		{
+			_move_assign(rhs, _indices());
+
+			return *this;
+		}
+
+		// Returns a value move-constructed from the referenced elements.
+		operator Value() &&
+		{
+			return _move_value(_indices());
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the referenced elements of lhs and rhs.
+		friend void swap(swappable_reference lhs, swappable_reference rhs)
+		{
+			Value tmp = std::move(lhs);
+			lhs = std::move(rhs);
+			rhs = std::move(tmp);
+		}
+
+
+	private:
+		/* Static functions */
+
+		// Gets the indices of the elements of Reference.
+		static constexpr auto _indices()
+		{
+			return std::make_index_sequence<std::tuple_size_v<Reference>>();
+		}
+
+
+		/* General functions */
+
+		// Move-assigns each referenced element from the corresponding element referenced by rhs.
+		template<std::size_t... Idx>
+		void _move_assign(swappable_reference& rhs, std::index_sequence<Idx...>)
+		{
+			((std::get<Idx>(static_cast<Reference&>(*this)) = std::move(std::get<Idx>(static_cast<Reference&>(rhs)))), ...);
+		}
+
+		// Returns a value move-constructed from the referenced elements.
+		template<std::size_t... Idx>
+		Value _move_value(std::index_sequence<Idx...>)
+		{
+			return Value(std::move(std::get<Idx>(static_cast<Reference&>(*this)))...);
+		}
+	};
+
+
+	/* Iterator adaptor for iterators whose reference type is a proxy class returned by value, which dereferences to a swappable_reference so that
+		the referenced elements can be swapped by std algorithms. Otherwise it behaves exactly as the base iterator. */
+	template<typename Iterator>
+	class swappable_iterator {
+	public:
+		/* Member types */
+
+		using iterator_type = Iterator;
+		using value_type = typename std::iterator_traits<Iterator>::value_type;
+		using reference = swappable_reference<typename std::iterator_traits<Iterator>::reference, value_type>;
+		using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+		using iterator_category = typename std::iterator_traits<Iterator>::iterator_category;
+
+
+		/* Special members */
+
+		// Destructs the base iterator.
+		~swappable_iterator() = default;
+
+		// Value-initializes the base iterator.
+		swappable_iterator() :
+			_base()
+		{}
+
+		// Copy-constructs the base iterator from that of other.
+		swappable_iterator(swappable_iterator const& other) = default;
+
+		// Move-constructs the base iterator from that of other.
+		swappable_iterator(swappable_iterator&& other) = default;
+
+		// Constructs the base iterator from the given value.
+		explicit swappable_iterator(Iterator base) :
+			_base(base)
+		{}
+
+
+		/* Operators */
+
+		// Copy-assigns the base iterator from that of rhs.
+		swappable_iterator& operator=(swappable_iterator const& rhs) = default;
+
+		// Move-assigns the base iterator from that of rhs.
+		swappable_iterator& operator=(swappable_iterator&& rhs) = default;
+
+		// Advances the base iterator by n.
+		swappable_iterator& operator+=(difference_type n)
+		{
+			_base += n;
+
+			return *this;
+		}
+
+		// Advances the base iterator by -n.
+		swappable_iterator& operator-=(difference_type n)
+		{
+			_base -= n;
+
+			return *this;
+		}
+
+		// Dereferences the base iterator, and returns the result as a swappable_reference.
+		reference operator*() const
+		{
+			return reference(*_base);
+		}
+
+		// Dereferences the base iterator at an offset of n, and returns the result as a swappable_reference.
+		reference operator[](difference_type n) const
+		{
+			return reference(_base[n]);
+		}
+
+		// Increments the base iterator, then returns the new state.
+		swappable_iterator& operator++()
+		{
+			++_base;
+
+			return *this;
+		}
+
+		// Increments the base iterator, then returns the previous state.
+		swappable_iterator operator++(int)
+		{
+			auto tmp = *this;
+
+			operator++();
+
+			return tmp;
+		}
+
+		// Decrements the base iterator, then returns the new state.
+		swappable_iterator& operator--()
+		{
+			--_base;
+
+			return *this;
+		}
+
+		// Decrements the base iterator, then returns the previous state.
+		swappable_iterator operator--(int)
+		{
+			auto tmp = *this;
+
+			operator--();
+
+			return tmp;
+		}
+
+
+		/* General functions */
+
+		// Gets the base iterator.
+		Iterator const& base() const
+		{
+			return _base;
+		}
+
+
+	private:
+		/* Variables */
+
+		Iterator _base;
+	};
+
+
+	// Returns a copy of lhs advanced by rhs.
+	template<typename Iterator>
+	swappable_iterator<Iterator> operator+(swappable_iterator<Iterator> const& lhs, typename swappable_iterator<Iterator>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp += rhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of rhs advanced by lhs.
+	template<typename Iterator>
+	swappable_iterator<Iterator> operator+(typename swappable_iterator<Iterator>::difference_type lhs, swappable_iterator<Iterator> const& rhs)
+	{
+		auto tmp = rhs;
+		tmp += lhs;
+
+		return tmp;
+	}
+
+	// Returns a copy of lhs advanced by -rhs.
+	template<typename Iterator>
+	swappable_iterator<Iterator> operator-(swappable_iterator<Iterator> const& lhs, typename swappable_iterator<Iterator>::difference_type rhs)
+	{
+		auto tmp = lhs;
+		tmp -= rhs;
+
+		return tmp;
+	}
+
+	// The distance between lhs and rhs is the difference between their base iterators.
+	template<typename Iterator1, typename Iterator2>
+	auto operator-(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() - rhs.base();
+	}
+
+	// lhs and rhs are considered equal if their base iterators are equal.
+	template<typename Iterator1, typename Iterator2>
+	bool operator==(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() == rhs.base();
+	}
+
+	// lhs and rhs are considered unequal if their base iterators are unequal.
+	template<typename Iterator1, typename Iterator2>
+	bool operator!=(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() != rhs.base();
+	}
+
+	// lhs is considered less than rhs if lhs's base iterator is less than rhs's base iterator.
+	template<typename Iterator1, typename Iterator2>
+	bool operator<(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() < rhs.base();
+	}
+
+	// lhs is considered less than or equal to rhs is lhs's base iterator is less than or equal to rhs's base iterator.
+	template<typename Iterator1, typename Iterator2>
+	bool operator<=(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() <= rhs.base();
+	}
+
+	// lhs is considered greater than rhs if lhs's base iterator is greater than rhs's base iterator.
+	template<typename Iterator1, typename Iterator2>
+	bool operator>(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() > rhs.base();
+	}
+
+	// lhs is considered greater than or equal to rhs if lhs's base iterator is greater than or equal to rhs's base iterator.
+	template<typename Iterator1, typename Iterator2>
+	bool operator>=(swappable_iterator<Iterator1> const& lhs, swappable_iterator<Iterator2> const& rhs)
+	{
+		return lhs.base() >= rhs.base();
+	}
+
+}
+
+
+// Specialization for tl::iterators::swappable_reference of a tuple, so that it can be used with structured bindings like the tuple itself.
+template<typename... Ts, typename Value>
+struct std::tuple_size<tl::iterators::swappable_reference<std::tuple<Ts...>, Value>> : std::tuple_size<std::tuple<Ts...>> {};
+
+// Specialization for tl::iterators::swappable_reference of a tuple, so that it can be used with structured bindings like the tuple itself.
+template<std::size_t I, typename... Ts, typename Value>
+struct std::tuple_element<I, tl::iterators::swappable_reference<std::tuple<Ts...>, Value>> : std::tuple_element<I, std::tuple<Ts...>> {};
+
+// Specialization for tl::iterators::swappable_iterator.
+template<typename Iterator>
+struct std::iterator_traits<tl::iterators::swappable_iterator<Iterator>> {
+	using value_type = typename tl::iterators::swappable_iterator<Iterator>::value_type;
+	using reference = typename tl::iterators::swappable_iterator<Iterator>::reference;
+	using pointer = void;
+	using difference_type = typename tl::iterators::swappable_iterator<Iterator>::difference_type;
+	using iterator_category = typename tl::iterators::swappable_iterator<Iterator>::iterator_category;
+};
+
+
+#endif
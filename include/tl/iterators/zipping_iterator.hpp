@@ -2,11 +2,13 @@
 #define TL_ITERATORS_ZIPPING_ITERATOR_HPP
 
 
+#include <cstddef>			// std::size_t
 #include <cstdlib>			// std::abs
-#include <functional>		// std::equal_to, std::logical_or, std::minus
+#include <functional>		// std::minus
 #include <iterator>			// std::iterator_traits
-#include <tuple>			// std::tuple
+#include <tuple>			// std::get, std::tuple
 #include <type_traits>		// std::common_type_t
+#include <utility>			// std::index_sequence, std::index_sequence_for
 
 #include <tl/tuple/foldl.hpp>		// tl::tuple::foldl
 #include <tl/tuple/for_each.hpp>	// tl::tuple::for_each
@@ -15,6 +17,19 @@
 
 namespace tl::iterators {
 
+	namespace detail {
+
+		// Returns true if any of the corresponding pairs of elements of lhs and rhs are equal, otherwise false.
+		template<class Tuple1, class Tuple2, std::size_t... Idx>
+		bool any_equal(Tuple1 const& lhs, Tuple2 const& rhs, std::index_sequence<Idx...>)
+		{
+			using std::get;
+			return ((get<Idx>(lhs) == get<Idx>(rhs)) || ...);
+		}
+
+	}
+
+
 	// Iterator adaptor that iterates multiple iterators simultaneouly and dereferences to a tuple of the results of dereferencing each iterator.
 	template<typename... Iterators>
 	class zipping_iterator {
@@ -201,11 +216,12 @@ namespace tl::iterators {
 			});
 	}
 
-	// lhs and rhs are considered equal if any of their corresponding pairs of base iterators are equal.
+	/* lhs and rhs are considered equal if any of their corresponding pairs of base iterators are equal.
+		The pairs are compared in order, stopping at the first equal pair. */
 	template<typename... Iterators1, typename... Iterators2>
 	bool operator==(zipping_iterator<Iterators1...> const& lhs, zipping_iterator<Iterators2...> const& rhs)
 	{
-		return tuple::foldl(tuple::transform(lhs.base(), rhs.base(), std::equal_to()), std::logical_or());
+		return detail::any_equal(lhs.base(), rhs.base(), std::index_sequence_for<Iterators1...>());
 	}
 
 	// lhs and rhs are considered unequal if none of their corresponding pairs of base iterators are equal.
@@ -9,12 +9,19 @@
 namespace tl::memory {
 
 	/* Allocates memory for and constructs one object using the given allocator and constructor arguments. Returns a pointer to the object.
-		Calls alloc.allocate() with an argument of exactly 1. 1 should be passed to the corresponding call to alloc.deallocate(). */
+		Calls alloc.allocate() with an argument of exactly 1. 1 should be passed to the corresponding call to alloc.deallocate().
+		If the constructor throws, the memory is deallocated before the exception propagates. */
 	template<class Allocator, typename... Args>
 	typename std::allocator_traits<Allocator>::pointer allocate_construct(Allocator& alloc, Args&&... args)
 	{
 		typename std::allocator_traits<Allocator>::pointer ptr = std::allocator_traits<Allocator>::allocate(alloc, 1);
-		std::allocator_traits<Allocator>::construct(alloc, ptr, std::forward<Args>(args)...);
+		try {
+			std::allocator_traits<Allocator>::construct(alloc, ptr, std::forward<Args>(args)...);
+		}
+		catch (...) {
+			std::allocator_traits<Allocator>::deallocate(alloc, ptr, 1);
+			throw;
+		}
 		return ptr;
 	}
 
@@ -5,29 +5,43 @@
 #include <memory>		// std::allocator_traits
 #include <utility>		// std::forward
 
+#include <tl/memory/default_construct_n.hpp>		// tl::memory::default_construct_n
+
 
 namespace tl::memory {
 
 	/* Allocates memory for and default constructs one object using the given allocator. Returns a pointer to the object.
-		Calls alloc.allocate() with an argument of exactly 1. 1 should be passed to the corresponding call to alloc.deallocate(). */
+		Calls alloc.allocate() with an argument of exactly 1. 1 should be passed to the corresponding call to alloc.deallocate().
+		If the constructor throws, the memory is deallocated before the exception propagates. */
 	template<class Allocator, typename... Args>
 	typename std::allocator_traits<Allocator>::pointer allocate_default_construct(Allocator& alloc)
 	{
 		typename std::allocator_traits<Allocator>::pointer ptr = std::allocator_traits<Allocator>::allocate(alloc, 1);
-		std::allocator_traits<Allocator>::construct(alloc, ptr);
+		try {
+			std::allocator_traits<Allocator>::construct(alloc, ptr);
+		}
+		catch (...) {
+			std::allocator_traits<Allocator>::deallocate(alloc, ptr, 1);
+			throw;
+		}
 		return ptr;
 	}
 
 
 	/* Allocates memory for and default constructs an array of count objects using the given allocator. Returns a pointer to the first object.
-		Calls alloc.allocate() with an argument of exactly count. The same value should be passed to the corresponding call to alloc.deallocate(). */
+		Calls alloc.allocate() with an argument of exactly count. The same value should be passed to the corresponding call to alloc.deallocate().
+		If a constructor throws, the objects already constructed are destroyed and the memory is deallocated before the exception propagates. */
 	template<class Allocator, typename... Args>
 	typename std::allocator_traits<Allocator>::pointer
 		allocate_default_construct(Allocator& alloc, typename std::allocator_traits<Allocator>::size_type count)
 	{
 		typename std::allocator_traits<Allocator>::pointer ptr = std::allocator_traits<Allocator>::allocate(alloc, count);
-		for (decltype(count) i{}; i < count; ++i) {
-			std::allocator_traits<Allocator>::construct(alloc, ptr + i);
+		try {
+			default_construct_n(alloc, ptr, count);
+		}
+		catch (...) {
+			std::allocator_traits<Allocator>::deallocate(alloc, ptr, count);
+			throw;
 		}
 		return ptr;
 	}
@@ -0,0 +1,281 @@
+#ifndef TL_MEMORY_ALLOCATION_TRACKER_HPP
+#define TL_MEMORY_ALLOCATION_TRACKER_HPP
+
+
+#include <algorithm>		// std::max
+#include <array>			// std::array
+#include <atomic>			// std::atomic, std::memory_order_relaxed
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <memory>			// std::make_unique, std::unique_ptr
+#include <mutex>			// std::lock_guard, std::mutex
+#include <vector>			// std::vector
+
+
+namespace tl::memory {
+
+	// Snapshot of the allocations recorded by an allocation_tracker.
+	struct allocation_statistics {
+		// Number of buckets in the size histogram.
+		static constexpr std::size_t histogram_buckets = 8 * sizeof(std::size_t);
+
+		// Number of allocations.
+		std::size_t allocations;
+
+		// Number of deallocations.
+		std::size_t deallocations;
+
+		// Total bytes allocated.
+		std::size_t allocated_bytes;
+
+		// Total bytes deallocated.
+		std::size_t deallocated_bytes;
+
+		// Bytes currently allocated.
+		std::size_t live_bytes;
+
+		/* Greatest number of bytes allocated at once. This is exact if only one thread allocates; otherwise, since threads only publish their
+			live bytes periodically, it is an estimate which may differ from the true peak by up to allocation_tracker::publish_threshold bytes per
+			thread. */
+		std::size_t peak_bytes;
+
+		// Number of allocations of each size. Bucket 0 counts sizes 0 and 1; bucket i > 0 counts sizes in [2^i, 2^(i+1)).
+		std::array<std::size_t, histogram_buckets> size_histogram;
+	};
+
+
+	/* Records statistics of allocations, separately for each Tag type (eg. a type identifying a call site or subsystem).
+		Each thread records into its own counters, so recording is cheap and does not contend between threads. statistics() sums the counters of
+		all threads, including those which have exited.
+		Allocations and deallocations may still be recorded by a thread after its counters have been retired (eg. from the destructors of other
+		thread_local objects, or of static objects at program exit); such calls record directly into the retired counters, under the mutex. */
+	template<typename Tag = void>
+	class allocation_tracker {
+	public:
+		/* Static variables */
+
+		// Number of bytes by which a thread's live bytes may change before it publishes them for peak tracking.
+		static constexpr std::size_t publish_threshold = 64 * 1024;
+
+
+		/* Static functions */
+
+		// Records an allocation of the given number of bytes.
+		static void record_allocation(std::size_t bytes)
+		{
+			if (_registration_destroyed()) {
+				_registry& registry = _get_registry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				_increment(registry.retired.allocations, 1);
+				_increment(registry.retired.allocated_bytes, bytes);
+				_increment(registry.retired.size_histogram[_bucket(bytes)], 1);
+				registry.retired.unpublished = static_cast<std::ptrdiff_t>(bytes);
+				_publish(registry.retired);
+				return;
+			}
+
+			_counters& counters = *_thread_counters().counters;
+			_increment(counters.allocations, 1);
+			_increment(counters.allocated_bytes, bytes);
+			_increment(counters.size_histogram[_bucket(bytes)], 1);
+			counters.unpublished += static_cast<std::ptrdiff_t>(bytes);
+			if (counters.unpublished > counters.unpublished_peak.load(std::memory_order_relaxed)) {
+				counters.unpublished_peak.store(counters.unpublished, std::memory_order_relaxed);
+			}
+			if (counters.unpublished >= static_cast<std::ptrdiff_t>(publish_threshold)) {
+				_publish(counters);
+			}
+		}
+
+		// Records a deallocation of the given number of bytes.
+		static void record_deallocation(std::size_t bytes)
+		{
+			if (_registration_destroyed()) {
+				_registry& registry = _get_registry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				_increment(registry.retired.deallocations, 1);
+				_increment(registry.retired.deallocated_bytes, bytes);
+				registry.retired.unpublished = -static_cast<std::ptrdiff_t>(bytes);
+				_publish(registry.retired);
+				return;
+			}
+
+			_counters& counters = *_thread_counters().counters;
+			_increment(counters.deallocations, 1);
+			_increment(counters.deallocated_bytes, bytes);
+			counters.unpublished -= static_cast<std::ptrdiff_t>(bytes);
+			if (counters.unpublished <= -static_cast<std::ptrdiff_t>(publish_threshold)) {
+				_publish(counters);
+			}
+		}
+
+		// Gets the statistics of all allocations recorded so far.
+		static allocation_statistics statistics()
+		{
+			_registry& registry = _get_registry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+
+			allocation_statistics result{};
+			_accumulate(result, registry.retired);
+			std::ptrdiff_t const live = registry.live.load(std::memory_order_relaxed);
+			std::ptrdiff_t peak = registry.peak.load(std::memory_order_relaxed);
+			for (_counters const* counters : registry.threads) {
+				_accumulate(result, *counters);
+				peak = std::max(peak, live + counters->unpublished_peak.load(std::memory_order_relaxed));
+			}
+			// Other threads may record concurrently, so the counters of different threads may not be mutually consistent.
+			result.live_bytes = result.allocated_bytes > result.deallocated_bytes ? result.allocated_bytes - result.deallocated_bytes : 0;
+			result.peak_bytes = std::max(static_cast<std::size_t>(peak), result.live_bytes);
+
+			return result;
+		}
+
+
+	private:
+		/* Member types */
+
+		// Counters of one thread. Only the owning thread writes to them, so relaxed loads and stores suffice.
+		struct _counters {
+			std::atomic<std::size_t> allocations;
+			std::atomic<std::size_t> deallocations;
+			std::atomic<std::size_t> allocated_bytes;
+			std::atomic<std::size_t> deallocated_bytes;
+			std::array<std::atomic<std::size_t>, allocation_statistics::histogram_buckets> size_histogram;
+
+			// Change in the thread's live bytes which has not yet been added to the registry's live bytes. Only accessed by the owning thread.
+			std::ptrdiff_t unpublished;
+
+			// Greatest value of unpublished since it was last published.
+			std::atomic<std::ptrdiff_t> unpublished_peak;
+		};
+
+		// Counters of all threads, shared between threads.
+		struct _registry {
+			// Guards threads and retired (including its unpublished live bytes, which are only used by threads whose registration was destroyed).
+			std::mutex mutex;
+
+			// Counters of the threads which are currently running.
+			std::vector<_counters*> threads;
+
+			// Sum of the counters of threads which have exited.
+			_counters retired;
+
+			// Sum of the published live bytes of all threads.
+			std::atomic<std::ptrdiff_t> live;
+
+			// Greatest value of live.
+			std::atomic<std::ptrdiff_t> peak;
+		};
+
+		// Registers a thread's counters on construction, and moves them into the retired counters on destruction.
+		struct _thread_registration {
+			_thread_registration() :
+				counters(std::make_unique<_counters>())
+			{
+				_registry& registry = _get_registry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				registry.threads.push_back(counters.get());
+			}
+
+			~_thread_registration()
+			{
+				_publish(*counters);
+
+				_registry& registry = _get_registry();
+				std::lock_guard<std::mutex> lock(registry.mutex);
+				_add(registry.retired.allocations, *counters, &_counters::allocations);
+				_add(registry.retired.deallocations, *counters, &_counters::deallocations);
+				_add(registry.retired.allocated_bytes, *counters, &_counters::allocated_bytes);
+				_add(registry.retired.deallocated_bytes, *counters, &_counters::deallocated_bytes);
+				for (std::size_t i = 0; i < allocation_statistics::histogram_buckets; ++i) {
+					_increment(registry.retired.size_histogram[i], counters->size_histogram[i].load(std::memory_order_relaxed));
+				}
+				for (auto it = registry.threads.begin(); it != registry.threads.end(); ++it) {
+					if (*it == counters.get()) {
+						registry.threads.erase(it);
+						break;
+					}
+				}
+				_registration_destroyed() = true;
+			}
+
+			std::unique_ptr<_counters> counters;
+		};
+
+
+		/* Static functions */
+
+		/* Gets the registry of all threads' counters. This is never destroyed, so that deallocations can be recorded by the destructors of static
+			objects which were constructed before the registry. */
+		static _registry& _get_registry()
+		{
+			static _registry* const registry = new _registry{};
+			return *registry;
+		}
+
+		// Gets the calling thread's registration, which owns its counters.
+		static _thread_registration& _thread_counters()
+		{
+			static thread_local _thread_registration registration;
+			return registration;
+		}
+
+		/* Gets whether the calling thread's registration has been destroyed (ie. the thread is exiting). This is trivially destructible, so remains
+			accessible until the thread ends, even from the destructors of other thread_local objects. */
+		static bool& _registration_destroyed()
+		{
+			static thread_local bool destroyed = false;
+			return destroyed;
+		}
+
+		// Gets the index of the histogram bucket for an allocation of the given number of bytes.
+		static std::size_t _bucket(std::size_t bytes)
+		{
+			std::size_t bucket = 0;
+			while (bytes >>= 1) {
+				++bucket;
+			}
+			return bucket;
+		}
+
+		// Increments a counter which is only written by one thread at a time.
+		static void _increment(std::atomic<std::size_t>& counter, std::size_t amount)
+		{
+			counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+		}
+
+		// Adds the given member of counters to the given counter.
+		static void _add(std::atomic<std::size_t>& counter, _counters const& counters, std::atomic<std::size_t> _counters::* member)
+		{
+			_increment(counter, (counters.*member).load(std::memory_order_relaxed));
+		}
+
+		// Adds a thread's unpublished live bytes to the registry's live bytes, and updates the peak with the thread's unpublished peak.
+		static void _publish(_counters& counters)
+		{
+			_registry& registry = _get_registry();
+			std::ptrdiff_t const previous_live = registry.live.fetch_add(counters.unpublished, std::memory_order_relaxed);
+			std::ptrdiff_t const candidate = previous_live + std::max(counters.unpublished, counters.unpublished_peak.load(std::memory_order_relaxed));
+			counters.unpublished = 0;
+			counters.unpublished_peak.store(0, std::memory_order_relaxed);
+
+			std::ptrdiff_t peak = registry.peak.load(std::memory_order_relaxed);
+			while (candidate > peak && !registry.peak.compare_exchange_weak(peak, candidate, std::memory_order_relaxed)) {}
+		}
+
+		// Adds the given counters to the given statistics.
+		static void _accumulate(allocation_statistics& statistics, _counters const& counters)
+		{
+			statistics.allocations += counters.allocations.load(std::memory_order_relaxed);
+			statistics.deallocations += counters.deallocations.load(std::memory_order_relaxed);
+			statistics.allocated_bytes += counters.allocated_bytes.load(std::memory_order_relaxed);
+			statistics.deallocated_bytes += counters.deallocated_bytes.load(std::memory_order_relaxed);
+			for (std::size_t i = 0; i < allocation_statistics::histogram_buckets; ++i) {
+				statistics.size_histogram[i] += counters.size_histogram[i].load(std::memory_order_relaxed);
+			}
+		}
+	};
+
+}
+
+
+#endif
@@ -0,0 +1,101 @@
+#ifndef TL_MEMORY_ARENA_ALLOCATOR_HPP
+#define TL_MEMORY_ARENA_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <limits>			// std::numeric_limits
+#include <new>				// std::bad_array_new_length
+
+#include <tl/memory/monotonic_arena.hpp>		// tl::memory::monotonic_arena
+
+
+namespace tl::memory {
+
+	/* Allocator which allocates from a monotonic_arena. Deallocation does nothing; the memory is freed when the arena is reset or destroyed.
+		Suitable for shared_array and standard containers whose lifetimes end before the arena is reset.
+		A default-constructed arena_allocator refers to no arena and must not be used to allocate; it exists so that containers can be
+		default-constructed and moved. */
+	template<typename T>
+	class arena_allocator {
+	public:
+		/* Member types */
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+
+
+		/* Special members */
+
+		// Constructs to refer to no arena.
+		arena_allocator() :
+			_arena()
+		{}
+
+		// Constructs to allocate from the given arena.
+		arena_allocator(monotonic_arena& arena) :
+			_arena(&arena)
+		{}
+
+		// Constructs to allocate from the same arena as other.
+		template<typename U>
+		arena_allocator(arena_allocator<U> const& other) :
+			_arena(other.arena())
+		{}
+
+
+		/* General functions */
+
+		// Allocates storage for n objects of type T from the arena. Throws std::bad_array_new_length if n is greater than max_size().
+		T* allocate(size_type n)
+		{
+			if (n > max_size()) {
+				throw std::bad_array_new_length();
+			}
+
+			return static_cast<T*>(_arena->allocate(n * sizeof(T), alignof(T)));
+		}
+
+		// Gets the arena allocated from, or null if there is none.
+		monotonic_arena* arena() const
+		{
+			return _arena;
+		}
+
+		// Gets the largest number of objects of type T which can be allocated at once, such that the size in bytes does not overflow.
+		size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max() / sizeof(T);
+		}
+
+		// Does nothing, since the arena frees all memory at once.
+		void deallocate(T*, size_type)
+		{}
+
+
+	private:
+		/* Variables */
+
+		// Arena to allocate from.
+		monotonic_arena* _arena;
+	};
+
+
+	// Returns true if lhs and rhs allocate from the same arena, otherwise false.
+	template<typename T, typename U>
+	bool operator==(arena_allocator<T> const& lhs, arena_allocator<U> const& rhs)
+	{
+		return lhs.arena() == rhs.arena();
+	}
+
+	// Returns false if lhs and rhs allocate from the same arena, otherwise true.
+	template<typename T, typename U>
+	bool operator!=(arena_allocator<T> const& lhs, arena_allocator<U> const& rhs)
+	{
+		return lhs.arena() != rhs.arena();
+	}
+
+}
+
+
+#endif
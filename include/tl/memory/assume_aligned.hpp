@@ -0,0 +1,32 @@
+#ifndef TL_MEMORY_ASSUME_ALIGNED_HPP
+#define TL_MEMORY_ASSUME_ALIGNED_HPP
+
+
+#include <cstddef>		// std::size_t
+#include <cstdint>		// std::uintptr_t
+
+
+namespace tl::memory {
+
+	/* Informs the compiler that ptr is aligned to at least N bytes, and returns ptr.
+		Behaviour is undefined if ptr is not actually aligned to N bytes. N must be a power of 2.
+		Equivalent to C++20's std::assume_aligned, where compiler support is available; otherwise simply returns ptr. */
+	template<std::size_t N, typename T>
+	T* assume_aligned(T* ptr)
+	{
+		static_assert(N != 0 && (N & (N - 1)) == 0, "N must be a power of 2.");
+
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<T*>(__builtin_assume_aligned(ptr, N));
+#elif defined(_MSC_VER)
+		__assume((reinterpret_cast<std::uintptr_t>(ptr) & (N - 1)) == 0);
+		return ptr;
+#else
+		return ptr;
+#endif
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,146 @@
+#ifndef TL_MEMORY_BUFFER_ALLOCATOR_HPP
+#define TL_MEMORY_BUFFER_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <limits>			// std::numeric_limits
+#include <memory>			// std::allocator, std::allocator_traits
+#include <new>				// std::bad_array_new_length
+#include <utility>			// std::swap
+
+#include <tl/memory/fixed_buffer.hpp>		// tl::memory::fixed_buffer
+
+
+namespace tl::memory {
+
+	/* Allocator which allocates from a fixed_buffer (eg. an inline_buffer on the stack), and from an allocator of type Upstream once the buffer
+		is used up. Thus small, short-lived arrays never allocate from the heap.
+		A default-constructed buffer_allocator refers to no buffer and allocates only from Upstream; it exists so that containers can be
+		default-constructed and moved. The buffer must outlive all memory allocated from it. */
+	template<typename T, class Upstream = std::allocator<T>>
+	class buffer_allocator {
+	public:
+		/* Member types */
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using upstream_type = Upstream;
+
+		template<typename U>
+		struct rebind {
+			using other = buffer_allocator<U, typename std::allocator_traits<Upstream>::template rebind_alloc<U>>;
+		};
+
+
+		/* Special members */
+
+		// Constructs to refer to no buffer, and constructs the upstream allocator from the given value.
+		buffer_allocator(Upstream upstream = Upstream()) :
+			_buffer(),
+			_upstream(upstream)
+		{}
+
+		// Constructs to allocate from the given buffer, and constructs the upstream allocator from the given value.
+		buffer_allocator(fixed_buffer& buffer, Upstream upstream = Upstream()) :
+			_buffer(&buffer),
+			_upstream(upstream)
+		{}
+
+		// Constructs to allocate from the same buffer as other, and constructs the upstream allocator from other's upstream allocator.
+		template<typename U, class OtherUpstream>
+		buffer_allocator(buffer_allocator<U, OtherUpstream> const& other) :
+			_buffer(other.buffer()),
+			_upstream(other.upstream())
+		{}
+
+
+		/* General functions */
+
+		/* Allocates storage for n objects of type T from the buffer if there is enough space, otherwise from the upstream allocator.
+			Throws std::bad_array_new_length if n is greater than max_size(). */
+		T* allocate(size_type n)
+		{
+			if (n > max_size()) {
+				throw std::bad_array_new_length();
+			}
+
+			if (_buffer) {
+				if (void* const ptr = _buffer->allocate(n * sizeof(T), alignof(T))) {
+					return static_cast<T*>(ptr);
+				}
+			}
+			return std::allocator_traits<Upstream>::allocate(_upstream, n);
+		}
+
+		// Gets the buffer allocated from, or null if there is none.
+		fixed_buffer* buffer() const
+		{
+			return _buffer;
+		}
+
+		// Deallocates storage for n objects of type T, previously obtained from allocate(n).
+		void deallocate(T* ptr, size_type n)
+		{
+			if (_buffer && _buffer->owns(ptr)) {
+				_buffer->deallocate(ptr, n * sizeof(T));
+			}
+			else {
+				std::allocator_traits<Upstream>::deallocate(_upstream, ptr, n);
+			}
+		}
+
+		// Gets the largest number of objects of type T which can be allocated at once, such that the size in bytes does not overflow.
+		size_type max_size() const
+		{
+			return std::numeric_limits<size_type>::max() / sizeof(T);
+		}
+
+		// Gets the allocator used once the buffer is used up.
+		Upstream const& upstream() const
+		{
+			return _upstream;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the buffers and upstream allocators of first and second.
+		friend void swap(buffer_allocator& first, buffer_allocator& second)
+		{
+			using std::swap;
+
+			swap(first._buffer, second._buffer);
+			swap(first._upstream, second._upstream);
+		}
+
+
+	private:
+		/* Variables */
+
+		// Buffer to allocate from first.
+		fixed_buffer* _buffer;
+
+		// Allocator to use once the buffer is used up.
+		Upstream _upstream;
+	};
+
+
+	// Returns true if lhs and rhs allocate from the same buffer and their upstream allocators are equal, otherwise false.
+	template<typename T, class UpstreamT, typename U, class UpstreamU>
+	bool operator==(buffer_allocator<T, UpstreamT> const& lhs, buffer_allocator<U, UpstreamU> const& rhs)
+	{
+		return lhs.buffer() == rhs.buffer() && lhs.upstream() == rhs.upstream();
+	}
+
+	// Returns false if lhs and rhs allocate from the same buffer and their upstream allocators are equal, otherwise true.
+	template<typename T, class UpstreamT, typename U, class UpstreamU>
+	bool operator!=(buffer_allocator<T, UpstreamT> const& lhs, buffer_allocator<U, UpstreamU> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}
+
+
+#endif
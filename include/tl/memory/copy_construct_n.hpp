@@ -0,0 +1,55 @@
+#ifndef TL_MEMORY_COPY_CONSTRUCT_N_HPP
+#define TL_MEMORY_COPY_CONSTRUCT_N_HPP
+
+
+#include <cstring>			// std::memcpy
+#include <iterator>			// std::iterator_traits
+#include <memory>			// std::addressof, std::allocator_traits, std::uninitialized_copy_n
+#include <type_traits>		// std::is_pointer_v, std::is_trivially_copyable_v
+
+#include <tl/memory/destroy_n.hpp>							// tl::memory::destroy_n
+#include <tl/memory/uses_default_construct.hpp>				// tl::memory::uses_default_construct_v
+#include <tl/type_support/is_remove_cv_same.hpp>			// tl::type_support::is_remove_cv_same_v
+
+
+namespace tl::memory {
+
+	/* Copy constructs count objects starting at ptr from the elements of the range starting at first, using the given allocator.
+		This is the allocator-aware counterpart of std::uninitialized_copy_n. If the allocator's construct is equivalent to placement new, the
+		objects are constructed with a single memcpy when first is a pointer to trivially copyable objects of the same type, or otherwise with
+		std::uninitialized_copy_n.
+		If a constructor throws, the objects already constructed are destroyed before the exception propagates. */
+	template<class Allocator, class InputIterator>
+	void copy_construct_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr, InputIterator first,
+		typename std::allocator_traits<Allocator>::size_type count)
+	{
+		using value_type = typename std::allocator_traits<Allocator>::value_type;
+		using source_type = typename std::iterator_traits<InputIterator>::value_type;
+
+		if constexpr (std::is_trivially_copyable_v<value_type> && std::is_pointer_v<InputIterator>
+				&& type_support::is_remove_cv_same_v<value_type, source_type> && uses_default_construct_v<Allocator, value_type, source_type const&>) {
+			if (count > 0) {
+				std::memcpy(std::addressof(*ptr), first, count * sizeof(value_type));
+			}
+		}
+		else if constexpr (uses_default_construct_v<Allocator, value_type, decltype(*first)>) {
+			std::uninitialized_copy_n(first, count, ptr);
+		}
+		else {
+			decltype(count) i{};
+			try {
+				for (; i < count; ++i, ++first) {
+					std::allocator_traits<Allocator>::construct(alloc, ptr + i, *first);
+				}
+			}
+			catch (...) {
+				destroy_n(alloc, ptr, i);
+				throw;
+			}
+		}
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef TL_MEMORY_DEFAULT_CONSTRUCT_N_HPP
+#define TL_MEMORY_DEFAULT_CONSTRUCT_N_HPP
+
+
+#include <memory>			// std::allocator_traits, std::uninitialized_value_construct_n
+#include <type_traits>		// std::is_trivially_default_constructible_v
+
+#include <tl/memory/destroy_n.hpp>					// tl::memory::destroy_n
+#include <tl/memory/uses_default_construct.hpp>		// tl::memory::uses_default_construct_v
+
+
+namespace tl::memory {
+
+	/* Default constructs count objects starting at ptr using the given allocator.
+		If the objects are trivially default constructible and the allocator's construct is equivalent to placement new, the objects are instead
+		value-initialized with std::uninitialized_value_construct_n, which the standard library may lower to memset.
+		If a constructor throws, the objects already constructed are destroyed before the exception propagates. */
+	template<class Allocator>
+	void default_construct_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr,
+		typename std::allocator_traits<Allocator>::size_type count)
+	{
+		using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+		if constexpr (std::is_trivially_default_constructible_v<value_type> && uses_default_construct_v<Allocator, value_type>) {
+			std::uninitialized_value_construct_n(ptr, count);
+		}
+		else {
+			decltype(count) i{};
+			try {
+				for (; i < count; ++i) {
+					std::allocator_traits<Allocator>::construct(alloc, ptr + i);
+				}
+			}
+			catch (...) {
+				destroy_n(alloc, ptr, i);
+				throw;
+			}
+		}
+	}
+
+}
+
+
+#endif
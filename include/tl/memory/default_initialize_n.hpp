@@ -0,0 +1,28 @@
+#ifndef TL_MEMORY_DEFAULT_INITIALIZE_N_HPP
+#define TL_MEMORY_DEFAULT_INITIALIZE_N_HPP
+
+
+#include <memory>			// std::allocator_traits
+#include <type_traits>		// std::is_trivially_default_constructible_v
+
+#include <tl/memory/default_construct_n.hpp>		// tl::memory::default_construct_n
+
+
+namespace tl::memory {
+
+	/* Default-initializes count objects starting at ptr, for storage which is about to be overwritten.
+		If the objects are trivially default constructible then nothing is done and the objects' values are indeterminate (the allocator's construct
+		is not called, similar to std::allocate_shared_for_overwrite). Otherwise, the objects are constructed as if by default_construct_n. */
+	template<class Allocator>
+	void default_initialize_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr,
+		typename std::allocator_traits<Allocator>::size_type count)
+	{
+		if constexpr (!std::is_trivially_default_constructible_v<typename std::allocator_traits<Allocator>::value_type>) {
+			default_construct_n(alloc, ptr, count);
+		}
+	}
+
+}
+
+
+#endif
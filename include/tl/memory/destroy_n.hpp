@@ -2,17 +2,25 @@
 #define TL_MEMORY_DESTROY_N_HPP
 
 
-#include <memory>		// std::allocator_traits
+#include <memory>			// std::allocator_traits
+#include <type_traits>		// std::is_trivially_destructible_v
+
+#include <tl/memory/uses_default_destroy.hpp>		// tl::memory::uses_default_destroy_v
 
 
 namespace tl::memory {
 
-	// Destructs count objects starting at ptr using the given allcoator.
+	/* Destructs count objects starting at ptr using the given allcoator.
+		If the objects are trivially destructible and the allocator's destroy is equivalent to direct destruction, nothing is done. */
 	template<class Allocator>
 	void destroy_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr, typename std::allocator_traits<Allocator>::size_type count)
 	{
-		for (decltype(count) i{}; i < count; ++i) {
-			std::allocator_traits<Allocator>::destroy(alloc, ptr + i);
+		using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+		if constexpr (!(std::is_trivially_destructible_v<value_type> && uses_default_destroy_v<Allocator, value_type>)) {
+			for (decltype(count) i{}; i < count; ++i) {
+				std::allocator_traits<Allocator>::destroy(alloc, ptr + i);
+			}
 		}
 	}
 
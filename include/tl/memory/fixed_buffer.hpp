@@ -0,0 +1,114 @@
+#ifndef TL_MEMORY_FIXED_BUFFER_HPP
+#define TL_MEMORY_FIXED_BUFFER_HPP
+
+
+#include <cstddef>			// std::max_align_t, std::size_t
+#include <cstdint>			// std::uintptr_t
+
+
+namespace tl::memory {
+
+	/* Allocates memory by bumping a pointer through a fixed, caller-provided buffer (eg. an array on the stack or inline in an object).
+		Allocation fails (returns null) once the buffer is used up, so it is normally used through buffer_allocator, which falls back to another
+		allocator. Deallocation only reclaims memory if it is the most recent allocation; otherwise the memory is reclaimed by reset().
+		Not thread-safe; a fixed_buffer should be used by only one thread at a time. */
+	class fixed_buffer {
+	public:
+		/* Special members */
+
+		// Constructs to allocate from the given buffer of size bytes. The buffer must outlive this object.
+		fixed_buffer(void* data, std::size_t size) :
+			_begin(static_cast<unsigned char*>(data)),
+			_current(_begin),
+			_end(_begin + size)
+		{}
+
+		fixed_buffer(fixed_buffer const& other) = delete;
+
+		fixed_buffer(fixed_buffer&& other) = delete;
+
+
+		/* Operators */
+
+		fixed_buffer& operator=(fixed_buffer const& rhs) = delete;
+
+		fixed_buffer& operator=(fixed_buffer&& rhs) = delete;
+
+
+		/* General functions */
+
+		/* Allocates size bytes aligned to alignment bytes (which must be a power of 2) from the buffer. Returns null if there is not enough space
+			remaining. */
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+		{
+			std::uintptr_t const current = reinterpret_cast<std::uintptr_t>(_current);
+			std::uintptr_t const aligned = (current + alignment - 1) & ~(alignment - 1);
+			if (aligned - current > static_cast<std::size_t>(_end - _current) || size > static_cast<std::size_t>(_end - _current) - (aligned - current)) {
+				return nullptr;
+			}
+
+			_current = reinterpret_cast<unsigned char*>(aligned) + size;
+			return reinterpret_cast<void*>(aligned);
+		}
+
+		/* Deallocates size bytes at ptr, previously obtained from allocate(). If this was the most recent allocation, the memory may be allocated
+			again; otherwise nothing is done. */
+		void deallocate(void* ptr, std::size_t size)
+		{
+			if (static_cast<unsigned char*>(ptr) + size == _current) {
+				_current = static_cast<unsigned char*>(ptr);
+			}
+		}
+
+		// Returns true if ptr points into the buffer, otherwise false.
+		bool owns(void const* ptr) const
+		{
+			std::uintptr_t const address = reinterpret_cast<std::uintptr_t>(ptr);
+			return address >= reinterpret_cast<std::uintptr_t>(_begin) && address < reinterpret_cast<std::uintptr_t>(_end);
+		}
+
+		// Makes the whole buffer available for allocation again. Any objects in it must have already been destroyed.
+		void reset()
+		{
+			_current = _begin;
+		}
+
+
+	private:
+		/* Variables */
+
+		// Start of the buffer.
+		unsigned char* _begin;
+
+		// Start of the unallocated memory in the buffer.
+		unsigned char* _current;
+
+		// End of the buffer.
+		unsigned char* _end;
+	};
+
+
+	/* fixed_buffer which contains its own buffer of Size bytes, so it can be declared on the stack or inline in an object.
+		Not movable, since allocations refer to the contained buffer. */
+	template<std::size_t Size, std::size_t Alignment = alignof(std::max_align_t)>
+	class inline_buffer : public fixed_buffer {
+	public:
+		/* Special members */
+
+		// Constructs to allocate from the contained buffer.
+		inline_buffer() :
+			fixed_buffer(_storage, Size)
+		{}
+
+
+	private:
+		/* Variables */
+
+		// Buffer from which memory is allocated.
+		alignas(Alignment) unsigned char _storage[Size];
+	};
+
+}
+
+
+#endif
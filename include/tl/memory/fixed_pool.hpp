@@ -0,0 +1,206 @@
+#ifndef TL_MEMORY_FIXED_POOL_HPP
+#define TL_MEMORY_FIXED_POOL_HPP
+
+
+#include <algorithm>		// std::max
+#include <atomic>			// std::atomic, std::memory_order_acquire, std::memory_order_relaxed, std::memory_order_release
+#include <cstddef>			// std::size_t
+#include <new>				// std::align_val_t, operator new
+
+
+namespace tl::memory {
+
+	/* Lock-free pool of fixed-size memory blocks of BlockSize bytes, aligned to BlockAlignment bytes.
+		There is a single pool per combination of BlockSize and BlockAlignment, accessed through static member functions.
+		Each thread has its own cache of free blocks, so allocation and deallocation usually require no synchronisation at all. When a thread's
+		cache is empty, it takes all the blocks in the shared depot with a single atomic exchange, or allocates a new chunk of blocks if the depot
+		is also empty. When a thread's cache grows too large, a batch of blocks is returned to the depot with a single atomic operation.
+		Since blocks are only ever taken from the depot all at once, the depot does not suffer from the ABA problem.
+		Blocks may still be allocated and deallocated by a thread after its cache has been destroyed (eg. from the destructors of other
+		thread_local objects); such calls go directly to the depot.
+		Memory obtained from the system is never returned to it; blocks are reused until the program ends. */
+	template<std::size_t BlockSize, std::size_t BlockAlignment = alignof(std::max_align_t)>
+	class fixed_pool {
+	public:
+		/* Static variables */
+
+		// Size in bytes of each block.
+		static constexpr std::size_t block_size = BlockSize;
+
+		// Alignment in bytes of each block.
+		static constexpr std::size_t block_alignment = BlockAlignment;
+
+
+		/* Static functions */
+
+		// Allocates a block of block_size bytes, aligned to block_alignment bytes.
+		static void* allocate()
+		{
+			if (_cache_destroyed()) {
+				return _allocate_uncached();
+			}
+
+			_cache& cache = _thread_cache();
+			if (!cache.head) {
+				cache.head = _depot().exchange(nullptr, std::memory_order_acquire);
+				cache.count = 0;
+				if (!cache.head) {
+					cache.head = _allocate_chunk();
+				}
+			}
+
+			_node* const block = cache.head;
+			cache.head = block->next;
+			if (cache.count > 0) {
+				--cache.count;
+			}
+			return block;
+		}
+
+		// Deallocates a block previously obtained from allocate() (possibly on another thread).
+		static void deallocate(void* block)
+		{
+			if (_cache_destroyed()) {
+				_node* const node = ::new(block) _node{nullptr};
+				_push_depot(node, node);
+				return;
+			}
+
+			_cache& cache = _thread_cache();
+			_node* const node = ::new(block) _node{cache.head};
+			cache.head = node;
+			++cache.count;
+
+			if (cache.count >= 2 * _batch_size) {
+				_return_batch(cache);
+			}
+		}
+
+
+	private:
+		/* Member types */
+
+		// Intrusive free list node, stored in the memory of each free block.
+		struct _node {
+			_node* next;
+		};
+
+		// A thread's cache of free blocks.
+		struct _cache {
+			// Returns all cached blocks to the depot.
+			~_cache()
+			{
+				if (head) {
+					_node* last = head;
+					while (last->next) {
+						last = last->next;
+					}
+					_push_depot(head, last);
+				}
+				_cache_destroyed() = true;
+			}
+
+			// Head of the list of free blocks.
+			_node* head;
+
+			// Lower bound on the number of blocks in the list (blocks taken from the depot are not counted).
+			std::size_t count;
+		};
+
+
+		/* Static variables */
+
+		// Actual alignment of each block, sufficient for both BlockAlignment and a free list node.
+		static constexpr std::size_t _alignment = std::max(BlockAlignment, alignof(_node));
+
+		// Actual size of each block, large enough to hold a free list node and a multiple of the alignment.
+		static constexpr std::size_t _stride = (std::max(BlockSize, sizeof(_node)) + _alignment - 1) / _alignment * _alignment;
+
+		// Number of blocks returned to the depot at once, and half the number of cached blocks which triggers a return.
+		static constexpr std::size_t _batch_size = 64;
+
+		// Number of blocks in each chunk allocated from the system.
+		static constexpr std::size_t _chunk_blocks = std::max<std::size_t>(16, 16384 / _stride);
+
+
+		/* Static functions */
+
+		// Gets the head of the shared list of free blocks.
+		static std::atomic<_node*>& _depot()
+		{
+			static std::atomic<_node*> depot{nullptr};
+			return depot;
+		}
+
+		// Gets the calling thread's cache of free blocks.
+		static _cache& _thread_cache()
+		{
+			static thread_local _cache cache{nullptr, 0};
+			return cache;
+		}
+
+		/* Gets whether the calling thread's cache has been destroyed (ie. the thread is exiting). This is trivially destructible, so remains
+			accessible until the thread ends, even from the destructors of other thread_local objects. */
+		static bool& _cache_destroyed()
+		{
+			static thread_local bool destroyed = false;
+			return destroyed;
+		}
+
+		// Allocates a block without a cache, by taking a block from the depot (or a new chunk) and returning the rest to the depot.
+		static void* _allocate_uncached()
+		{
+			_node* head = _depot().exchange(nullptr, std::memory_order_acquire);
+			if (!head) {
+				head = _allocate_chunk();
+			}
+
+			_node* const block = head;
+			head = head->next;
+			if (head) {
+				_node* last = head;
+				while (last->next) {
+					last = last->next;
+				}
+				_push_depot(head, last);
+			}
+			return block;
+		}
+
+		// Pushes the list of blocks from first to last (inclusive) onto the depot.
+		static void _push_depot(_node* first, _node* last)
+		{
+			std::atomic<_node*>& depot = _depot();
+			last->next = depot.load(std::memory_order_relaxed);
+			while (!depot.compare_exchange_weak(last->next, first, std::memory_order_release, std::memory_order_relaxed)) {}
+		}
+
+		// Moves a batch of blocks from the given cache to the depot.
+		static void _return_batch(_cache& cache)
+		{
+			_node* const first = cache.head;
+			_node* last = first;
+			for (std::size_t i = 1; i < _batch_size; ++i) {
+				last = last->next;
+			}
+			cache.head = last->next;
+			cache.count -= _batch_size;
+			_push_depot(first, last);
+		}
+
+		// Allocates a new chunk of blocks from the system and returns them as a list.
+		static _node* _allocate_chunk()
+		{
+			unsigned char* const chunk = static_cast<unsigned char*>(::operator new(_chunk_blocks * _stride, std::align_val_t(_alignment)));
+			_node* head = nullptr;
+			for (std::size_t i = _chunk_blocks; i-- > 0;) {
+				head = ::new(static_cast<void*>(chunk + i * _stride)) _node{head};
+			}
+			return head;
+		}
+	};
+
+}
+
+
+#endif
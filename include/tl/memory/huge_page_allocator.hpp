@@ -0,0 +1,195 @@
+#ifndef TL_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+#define TL_MEMORY_HUGE_PAGE_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <cstdint>			// std::uintptr_t
+#include <limits>			// std::numeric_limits
+#include <memory>			// std::allocator, std::allocator_traits
+#include <new>				// std::bad_alloc, std::bad_array_new_length
+#include <utility>			// std::swap
+
+#include <sys/mman.h>		// madvise, mmap, munmap, MADV_HUGEPAGE, MAP_ANONYMOUS, MAP_FAILED, MAP_HUGE_SHIFT, MAP_HUGETLB, MAP_PRIVATE, PROT_READ, PROT_WRITE
+
+
+namespace tl::memory {
+
+	namespace detail {
+
+		// Size in bytes of the huge pages requested by huge_page_allocator.
+		inline constexpr std::size_t huge_page_size = std::size_t{2} << 20;
+
+
+		// Rounds bytes up to a multiple of huge_page_size.
+		constexpr std::size_t round_to_huge_pages(std::size_t bytes)
+		{
+			return (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+		}
+
+
+		/* Maps bytes (a multiple of huge_page_size) of anonymous memory, preferably backed by huge pages. Throws std::bad_alloc on failure.
+			First tries explicit huge pages of huge_page_size (MAP_HUGETLB, with the page size encoded above MAP_HUGE_SHIFT), which requires huge
+			pages to have been reserved by the system administrator. The page size is given explicitly because the system's default huge page size
+			may be larger (eg. 1 GiB), in which case the mapping could not be unmapped in multiples of huge_page_size. Otherwise,
+			maps normal pages aligned to huge_page_size and advises the kernel to back them with transparent huge pages (MADV_HUGEPAGE). */
+		inline void* map_huge_pages(std::size_t bytes)
+		{
+			constexpr int protection = PROT_READ | PROT_WRITE;
+			constexpr int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+			// log2 of huge_page_size.
+			constexpr int huge_page_shift = 21;
+			static_assert(std::size_t{1} << huge_page_shift == huge_page_size);
+
+			void* const huge = ::mmap(nullptr, bytes, protection, flags | MAP_HUGETLB | (huge_page_shift << MAP_HUGE_SHIFT), -1, 0);
+			if (huge != MAP_FAILED) {
+				return huge;
+			}
+#endif
+
+			// Over-allocate by a huge page so the mapping can be trimmed to a huge page boundary, which transparent huge pages require.
+			void* const mapping = ::mmap(nullptr, bytes + huge_page_size, protection, flags, -1, 0);
+			if (mapping == MAP_FAILED) {
+				throw std::bad_alloc();
+			}
+
+			std::uintptr_t const start = reinterpret_cast<std::uintptr_t>(mapping);
+			std::uintptr_t const aligned = (start + huge_page_size - 1) / huge_page_size * huge_page_size;
+			if (aligned != start) {
+				::munmap(mapping, aligned - start);
+			}
+			if (std::size_t const tail = huge_page_size - (aligned - start); tail != 0) {
+				::munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+			}
+
+#ifdef MADV_HUGEPAGE
+			// Advice is only a hint, so failure is not an error.
+			::madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+
+			return reinterpret_cast<void*>(aligned);
+		}
+
+	}
+
+
+	/* Allocator which serves large allocations with memory backed by huge pages, reducing TLB misses when accessing large arrays.
+		Allocations of at least min_bytes are mapped directly from the operating system with map_huge_pages(), rounded up to a multiple of the
+		huge page size. Smaller allocations are served by an allocator of type Fallback.
+		Requires a POSIX system; huge pages are only requested where the system supports them (eg. Linux). */
+	template<typename T, class Fallback = std::allocator<T>>
+	class huge_page_allocator {
+	public:
+		/* Member types */
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using fallback_type = Fallback;
+
+		template<typename U>
+		struct rebind {
+			using other = huge_page_allocator<U, typename std::allocator_traits<Fallback>::template rebind_alloc<U>>;
+		};
+
+
+		/* Static variables */
+
+		// Minimum size in bytes of an allocation to be backed by huge pages.
+		static constexpr std::size_t min_bytes = detail::huge_page_size;
+
+
+		/* Special members */
+
+		// Constructs the fallback allocator from the given value.
+		huge_page_allocator(Fallback fallback = Fallback()) :
+			_fallback(fallback)
+		{}
+
+		// Constructs the fallback allocator from other's fallback allocator.
+		template<typename U, class OtherFallback>
+		huge_page_allocator(huge_page_allocator<U, OtherFallback> const& other) :
+			_fallback(other.fallback())
+		{}
+
+
+		/* General functions */
+
+		// Allocates storage for n objects of type T.
+		T* allocate(size_type n)
+		{
+			if (n > max_size()) {
+				throw std::bad_array_new_length();
+			}
+
+			if (n * sizeof(T) >= min_bytes) {
+				return static_cast<T*>(detail::map_huge_pages(detail::round_to_huge_pages(n * sizeof(T))));
+			}
+			else {
+				return std::allocator_traits<Fallback>::allocate(_fallback, n);
+			}
+		}
+
+		// Deallocates storage for n objects of type T, previously obtained from allocate(n).
+		void deallocate(T* ptr, size_type n)
+		{
+			if (n * sizeof(T) >= min_bytes) {
+				::munmap(ptr, detail::round_to_huge_pages(n * sizeof(T)));
+			}
+			else {
+				std::allocator_traits<Fallback>::deallocate(_fallback, ptr, n);
+			}
+		}
+
+		/* Gets the largest number of objects of type T which can be allocated at once, such that the size in bytes can be rounded up and
+			over-allocated by map_huge_pages() without overflow. */
+		size_type max_size() const
+		{
+			return (std::numeric_limits<size_type>::max() - 2 * detail::huge_page_size) / sizeof(T);
+		}
+
+		// Gets the allocator used for small allocations.
+		Fallback const& fallback() const
+		{
+			return _fallback;
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the fallback allocators of first and second.
+		friend void swap(huge_page_allocator& first, huge_page_allocator& second)
+		{
+			using std::swap;
+
+			swap(first._fallback, second._fallback);
+		}
+
+
+	private:
+		/* Variables */
+
+		// Allocator for allocations smaller than min_bytes.
+		Fallback _fallback;
+	};
+
+
+	// Returns true if the fallback allocators of lhs and rhs are equal, otherwise false.
+	template<typename T, class FallbackT, typename U, class FallbackU>
+	bool operator==(huge_page_allocator<T, FallbackT> const& lhs, huge_page_allocator<U, FallbackU> const& rhs)
+	{
+		return lhs.fallback() == rhs.fallback();
+	}
+
+	// Returns false if the fallback allocators of lhs and rhs are equal, otherwise true.
+	template<typename T, class FallbackT, typename U, class FallbackU>
+	bool operator!=(huge_page_allocator<T, FallbackT> const& lhs, huge_page_allocator<U, FallbackU> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,145 @@
+#ifndef TL_MEMORY_MONOTONIC_ARENA_HPP
+#define TL_MEMORY_MONOTONIC_ARENA_HPP
+
+
+#include <algorithm>		// std::max
+#include <cstddef>			// std::max_align_t, std::size_t
+#include <cstdint>			// std::uintptr_t
+#include <limits>			// std::numeric_limits
+#include <new>				// operator delete, operator new, std::bad_alloc
+
+
+namespace tl::memory {
+
+	/* Allocates memory by bumping a pointer through large chunks obtained from the system, and frees all of it at once.
+		Individual allocations are never freed, so allocation is a few instructions and deallocation is free. The memory is released all at once
+		by reset() or the destructor, which is O(number of chunks) regardless of the number of allocations.
+		Each chunk is twice the size of the previous one, so the number of chunks is logarithmic in the total memory allocated.
+		Not thread-safe; a monotonic_arena should be used by only one thread at a time. */
+	class monotonic_arena {
+	public:
+		/* Static variables */
+
+		// Size in bytes of the first chunk, if not specified.
+		static constexpr std::size_t default_initial_size = 4096;
+
+
+		/* Special members */
+
+		// Deallocates all chunks.
+		~monotonic_arena()
+		{
+			_release(nullptr);
+		}
+
+		// Constructs with no chunks. The first chunk will be at least initial_size bytes.
+		explicit monotonic_arena(std::size_t initial_size = default_initial_size) :
+			_chunk(),
+			_current(),
+			_end(),
+			_next_size(std::max<std::size_t>(initial_size, sizeof(_chunk_header)))
+		{}
+
+		monotonic_arena(monotonic_arena const& other) = delete;
+
+		monotonic_arena(monotonic_arena&& other) = delete;
+
+
+		/* Operators */
+
+		monotonic_arena& operator=(monotonic_arena const& rhs) = delete;
+
+		monotonic_arena& operator=(monotonic_arena&& rhs) = delete;
+
+
+		/* General functions */
+
+		/* Allocates size bytes aligned to alignment bytes (which must be a power of 2). The memory remains valid until reset() or destruction.
+			Throws std::bad_alloc if a chunk large enough cannot be obtained (including if its size in bytes would overflow). */
+		void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+		{
+			std::uintptr_t const current = reinterpret_cast<std::uintptr_t>(_current);
+			std::uintptr_t const aligned = (current + alignment - 1) & ~(alignment - 1);
+			std::uintptr_t const end = reinterpret_cast<std::uintptr_t>(_end);
+			if (!_current || aligned > end || size > end - aligned) {
+				return _allocate_chunk(size, alignment);
+			}
+
+			_current = reinterpret_cast<unsigned char*>(aligned) + size;
+			return reinterpret_cast<void*>(aligned);
+		}
+
+		/* Deallocates all memory allocated from the arena, except the most recently obtained (and therefore largest) chunk, which is retained for
+			reuse. Any objects in the memory must have already been destroyed (or be trivially destructible). */
+		void reset()
+		{
+			if (_chunk) {
+				_release(_chunk);
+				_chunk->previous = nullptr;
+				_current = reinterpret_cast<unsigned char*>(_chunk + 1);
+			}
+		}
+
+
+	private:
+		/* Member types */
+
+		// Header at the start of each chunk, forming a linked list from the most recent chunk.
+		struct alignas(std::max_align_t) _chunk_header {
+			_chunk_header* previous;
+			std::size_t size;
+		};
+
+
+		/* General functions */
+
+		/* Obtains a new chunk large enough for an allocation of size bytes aligned to alignment bytes, and allocates from it.
+			Throws std::bad_alloc if the size of the chunk would overflow. */
+		void* _allocate_chunk(std::size_t size, std::size_t alignment)
+		{
+			constexpr std::size_t max_size = std::numeric_limits<std::size_t>::max();
+			if (size > max_size - sizeof(_chunk_header) - alignment) {
+				throw std::bad_alloc();
+			}
+
+			std::size_t const chunk_size = std::max(_next_size, sizeof(_chunk_header) + size + alignment);
+			_chunk_header* const chunk = ::new(::operator new(chunk_size)) _chunk_header{_chunk, chunk_size};
+			_chunk = chunk;
+			_current = reinterpret_cast<unsigned char*>(chunk + 1);
+			_end = reinterpret_cast<unsigned char*>(chunk) + chunk_size;
+			_next_size = chunk_size <= max_size / 2 ? 2 * chunk_size : max_size;
+
+			return allocate(size, alignment);
+		}
+
+		// Deallocates all chunks older than keep (or all chunks, if keep is null).
+		void _release(_chunk_header* keep)
+		{
+			_chunk_header* chunk = keep ? keep->previous : _chunk;
+			while (chunk) {
+				_chunk_header* const previous = chunk->previous;
+				::operator delete(chunk);
+				chunk = previous;
+			}
+		}
+
+
+		/* Variables */
+
+		// Most recently obtained chunk, or null if there are none.
+		_chunk_header* _chunk;
+
+		// Start of the unallocated memory in the current chunk.
+		unsigned char* _current;
+
+		// End of the current chunk.
+		unsigned char* _end;
+
+		// Minimum size in bytes of the next chunk.
+		std::size_t _next_size;
+	};
+
+}
+
+
+#endif
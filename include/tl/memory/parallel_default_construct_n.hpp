@@ -0,0 +1,160 @@
+#ifndef TL_MEMORY_PARALLEL_DEFAULT_CONSTRUCT_N_HPP
+#define TL_MEMORY_PARALLEL_DEFAULT_CONSTRUCT_N_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <cstdint>			// std::uintptr_t
+#include <exception>		// std::current_exception, std::exception_ptr, std::rethrow_exception
+#include <memory>			// std::addressof, std::allocator_traits
+#include <thread>			// std::thread
+#include <vector>			// std::vector
+
+#ifdef TL_USE_LIBNUMA
+#include <numa.h>			// numa_available, numa_max_node, numa_tonode_memory
+#include <unistd.h>			// sysconf, _SC_PAGESIZE
+#endif
+
+#include <tl/execution/static_partition.hpp>		// tl::execution::static_partition
+#include <tl/execution/thread_pool.hpp>				// tl::execution::thread_pool
+#include <tl/memory/default_construct_n.hpp>		// tl::memory::default_construct_n
+#include <tl/memory/destroy_n.hpp>					// tl::memory::destroy_n
+
+
+namespace tl::memory {
+
+	namespace detail {
+
+		/* If TL_USE_LIBNUMA is defined and the system supports NUMA, binds the pages wholly within [first, first + bytes) to the NUMA node
+			corresponding to the given part, such that the parts are spread evenly over the nodes in order. Otherwise does nothing. */
+		inline void bind_partition([[maybe_unused]] void* first, [[maybe_unused]] std::size_t bytes, [[maybe_unused]] std::size_t index,
+			[[maybe_unused]] std::size_t parts)
+		{
+#ifdef TL_USE_LIBNUMA
+			if (::numa_available() != -1) {
+				std::uintptr_t const page_size = static_cast<std::uintptr_t>(::sysconf(_SC_PAGESIZE));
+				std::uintptr_t const begin = (reinterpret_cast<std::uintptr_t>(first) + page_size - 1) / page_size * page_size;
+				std::uintptr_t const end = (reinterpret_cast<std::uintptr_t>(first) + bytes) / page_size * page_size;
+				if (begin < end) {
+					std::size_t const nodes = static_cast<std::size_t>(::numa_max_node()) + 1;
+					::numa_tonode_memory(reinterpret_cast<void*>(begin), end - begin, static_cast<int>(index * nodes / parts));
+				}
+			}
+#endif
+		}
+
+	}
+
+
+	namespace detail {
+
+		/* Default constructs count objects starting at ptr using the given allocator, divided into parts with execution::static_partition.
+			run(parts, construct_part) must call construct_part(i) once for each part index i (possibly concurrently) and return once all the calls
+			have completed. If any constructor throws, all constructed objects are destroyed before one of the exceptions propagates. */
+		template<class Allocator, typename Run>
+		void parallel_default_construct_parts(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr,
+			typename std::allocator_traits<Allocator>::size_type count, std::size_t parts, Run run)
+		{
+			using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+			std::vector<std::exception_ptr> errors(parts);
+			auto construct_part = [&](std::size_t index) {
+				execution::index_range const part = execution::static_partition(count, parts, index);
+				try {
+					bind_partition(std::addressof(ptr[part.first]), (part.last - part.first) * sizeof(value_type), index, parts);
+					default_construct_n(alloc, ptr + part.first, part.last - part.first);
+				}
+				catch (...) {
+					errors[index] = std::current_exception();
+				}
+			};
+
+			run(parts, construct_part);
+
+			std::exception_ptr error;
+			for (std::size_t i = 0; i < parts; ++i) {
+				if (errors[i]) {
+					error = errors[i];
+				}
+			}
+			if (error) {
+				// Parts whose construction failed have already been destroyed by default_construct_n.
+				for (std::size_t i = 0; i < parts; ++i) {
+					if (!errors[i]) {
+						execution::index_range const part = execution::static_partition(count, parts, i);
+						destroy_n(alloc, ptr + part.first, part.last - part.first);
+					}
+				}
+				std::rethrow_exception(error);
+			}
+		}
+
+	}
+
+
+	/* Default constructs count objects starting at ptr using the given allocator, dividing the work between the given number of new threads.
+		The objects are divided with execution::static_partition. Since the operating system usually places a page on the NUMA node of the
+		thread which first writes to it, this spreads the array's pages over the nodes used by the threads (first-touch placement). However, the
+		threads are created for this call and are not pinned, so later work is only local to the same pages if it happens to run on the same
+		nodes; to guarantee this, use the thread_pool overload with pinned workers.
+		If TL_USE_LIBNUMA is defined (and libnuma is linked), each part's pages are also explicitly bound to a NUMA node with mbind.
+		The allocator's construct must be safe to call concurrently. If any constructor throws, all constructed objects are destroyed before one
+		of the exceptions propagates. If threads cannot be created, the remaining parts are constructed on the calling thread. */
+	template<class Allocator>
+	void parallel_default_construct_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr,
+		typename std::allocator_traits<Allocator>::size_type count, std::size_t threads)
+	{
+		if (threads <= 1 || count < threads) {
+			default_construct_n(alloc, ptr, count);
+			return;
+		}
+
+		detail::parallel_default_construct_parts(alloc, ptr, count, threads, [](std::size_t parts, auto& construct_part) {
+			/* The calling thread constructs the first part. If a thread cannot be created (std::system_error) or the vector cannot be allocated
+				(std::bad_alloc), the threads already started are still joined below, and the remaining parts are constructed on this thread.
+				construct_part never throws, so nothing can leave the threads joinable. */
+			std::vector<std::thread> workers;
+			std::size_t index = 1;
+			try {
+				workers.reserve(parts - 1);
+				for (; index < parts; ++index) {
+					workers.emplace_back(construct_part, index);
+				}
+			}
+			catch (...) {
+				for (std::size_t i = index; i < parts; ++i) {
+					construct_part(i);
+				}
+			}
+			construct_part(0);
+			for (std::thread& worker : workers) {
+				worker.join();
+			}
+		});
+	}
+
+
+	/* Default constructs count objects starting at ptr using the given allocator, dividing the work between the workers of the given pool.
+		The objects are divided with execution::static_partition into one part per worker, and part i is constructed by worker i (with
+		thread_pool::run_pinned). This is the same division and placement used by execution::pool_policy::pinned(pool), so if the pool's workers
+		are pinned to CPUs, the parallel algorithms of tl::ranges with that policy access each element from the thread (and so the NUMA node)
+		which first touched it.
+		Otherwise behaves like the overload taking a number of threads. */
+	template<class Allocator>
+	void parallel_default_construct_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer ptr,
+		typename std::allocator_traits<Allocator>::size_type count, execution::thread_pool& pool)
+	{
+		std::size_t const parts = pool.size();
+		if (parts <= 1 || count < parts) {
+			default_construct_n(alloc, ptr, count);
+			return;
+		}
+
+		detail::parallel_default_construct_parts(alloc, ptr, count, parts, [&pool](std::size_t n, auto& construct_part) {
+			pool.run_pinned(n, construct_part);
+		});
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef TL_MEMORY_POOL_ALLOCATOR_HPP
+#define TL_MEMORY_POOL_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <memory>			// std::allocator
+#include <type_traits>		// std::true_type
+
+#include <tl/memory/fixed_pool.hpp>		// tl::memory::fixed_pool
+
+
+namespace tl::memory {
+
+	/* Allocator which serves allocations of single objects from a fixed_pool, and all other allocations from std::allocator.
+		This suits small, short-lived objects which are allocated one at a time, such as the control blocks of reference-counted containers (eg.
+		the local state of local_shared_array, or the shared state of shared_array in external storage), for which the general-purpose
+		allocator is comparatively slow and may suffer from contention between threads.
+		All instances are interchangeable, and memory may be deallocated on a different thread to that which allocated it. */
+	template<typename T>
+	class pool_allocator {
+	public:
+		/* Member types */
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+
+		/* Special members */
+
+		pool_allocator() = default;
+
+		// Constructs from a pool_allocator of another type. Since pool_allocator is stateless, this has no effect.
+		template<typename U>
+		pool_allocator(pool_allocator<U> const&)
+		{}
+
+
+		/* General functions */
+
+		// Allocates storage for n objects of type T.
+		T* allocate(size_type n)
+		{
+			if (n == 1) {
+				return static_cast<T*>(_pool::allocate());
+			}
+			else {
+				return std::allocator<T>().allocate(n);
+			}
+		}
+
+		// Deallocates storage for n objects of type T, previously obtained from allocate(n).
+		void deallocate(T* ptr, size_type n)
+		{
+			if (n == 1) {
+				_pool::deallocate(ptr);
+			}
+			else {
+				std::allocator<T>().deallocate(ptr, n);
+			}
+		}
+
+
+	private:
+		/* Member types */
+
+		using _pool = fixed_pool<sizeof(T), alignof(T)>;
+	};
+
+
+	// All pool_allocators are equal.
+	template<typename T, typename U>
+	bool operator==(pool_allocator<T> const&, pool_allocator<U> const&)
+	{
+		return true;
+	}
+
+	// All pool_allocators are equal.
+	template<typename T, typename U>
+	bool operator!=(pool_allocator<T> const&, pool_allocator<U> const&)
+	{
+		return false;
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef TL_MEMORY_RELOCATE_N_HPP
+#define TL_MEMORY_RELOCATE_N_HPP
+
+
+#include <cstring>			// std::memcpy
+#include <memory>			// std::addressof, std::allocator_traits
+#include <type_traits>		// std::is_trivially_copyable_v
+#include <utility>			// std::move_if_noexcept
+
+#include <tl/memory/destroy_n.hpp>					// tl::memory::destroy_n
+#include <tl/memory/uses_default_construct.hpp>		// tl::memory::uses_default_construct_v
+#include <tl/memory/uses_default_destroy.hpp>		// tl::memory::uses_default_destroy_v
+
+
+namespace tl::memory {
+
+	/* Relocates count objects starting at src to the uninitialized storage starting at dst, using the given allocator.
+		That is, the objects are move constructed (or copy constructed, if the move constructor may throw) at dst, then the objects at src are
+		destroyed. The ranges must not overlap.
+		If the objects are trivially copyable and the allocator's construct and destroy are equivalent to placement new and direct destruction,
+		the objects are instead relocated with a single memcpy.
+		If a constructor throws, the objects already constructed at dst are destroyed before the exception propagates, and the objects at src are
+		left intact (though they may have been moved from, if their move constructors may throw and they are not copy constructible). */
+	template<class Allocator>
+	void relocate_n(Allocator& alloc, typename std::allocator_traits<Allocator>::pointer src, typename std::allocator_traits<Allocator>::pointer dst,
+		typename std::allocator_traits<Allocator>::size_type count)
+	{
+		using value_type = typename std::allocator_traits<Allocator>::value_type;
+
+		if constexpr (std::is_trivially_copyable_v<value_type> && uses_default_construct_v<Allocator, value_type, value_type&&>
+				&& uses_default_destroy_v<Allocator, value_type>) {
+			if (count > 0) {
+				std::memcpy(std::addressof(*dst), std::addressof(*src), count * sizeof(value_type));
+			}
+		}
+		else {
+			decltype(count) i{};
+			try {
+				for (; i < count; ++i) {
+					std::allocator_traits<Allocator>::construct(alloc, dst + i, std::move_if_noexcept(src[i]));
+				}
+			}
+			catch (...) {
+				destroy_n(alloc, dst, i);
+				throw;
+			}
+			destroy_n(alloc, src, count);
+		}
+	}
+
+}
+
+
+#endif
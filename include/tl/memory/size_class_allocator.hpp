@@ -0,0 +1,71 @@
+#ifndef TL_MEMORY_SIZE_CLASS_ALLOCATOR_HPP
+#define TL_MEMORY_SIZE_CLASS_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::ptrdiff_t, std::size_t
+#include <type_traits>		// std::true_type
+
+#include <tl/memory/size_class_pool.hpp>		// tl::memory::size_class_pool
+
+
+namespace tl::memory {
+
+	/* Allocator which allocates from size_class_pool.
+		Suitable for node-based containers, control blocks and other small objects which are allocated and deallocated frequently from many
+		threads. All instances are interchangeable, and memory may be deallocated on a different thread to that which allocated it. */
+	template<typename T>
+	class size_class_allocator {
+	public:
+		/* Member types */
+
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+
+		/* Special members */
+
+		size_class_allocator() = default;
+
+		// Constructs from a size_class_allocator of another type. Since size_class_allocator is stateless, this has no effect.
+		template<typename U>
+		size_class_allocator(size_class_allocator<U> const&)
+		{}
+
+
+		/* General functions */
+
+		// Allocates storage for n objects of type T.
+		T* allocate(size_type n)
+		{
+			return static_cast<T*>(size_class_pool::allocate(n * sizeof(T), alignof(T)));
+		}
+
+		// Deallocates storage for n objects of type T, previously obtained from allocate(n).
+		void deallocate(T* ptr, size_type n)
+		{
+			size_class_pool::deallocate(ptr, n * sizeof(T), alignof(T));
+		}
+	};
+
+
+	// All size_class_allocators are equal.
+	template<typename T, typename U>
+	bool operator==(size_class_allocator<T> const&, size_class_allocator<U> const&)
+	{
+		return true;
+	}
+
+	// All size_class_allocators are equal.
+	template<typename T, typename U>
+	bool operator!=(size_class_allocator<T> const&, size_class_allocator<U> const&)
+	{
+		return false;
+	}
+
+}
+
+
+#endif
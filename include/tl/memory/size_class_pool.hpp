@@ -0,0 +1,92 @@
+#ifndef TL_MEMORY_SIZE_CLASS_POOL_HPP
+#define TL_MEMORY_SIZE_CLASS_POOL_HPP
+
+
+#include <cstddef>			// std::max_align_t, std::size_t
+#include <new>				// std::align_val_t, operator delete, operator new
+#include <utility>			// std::index_sequence, std::make_index_sequence
+
+#include <tl/memory/fixed_pool.hpp>		// tl::memory::fixed_pool
+
+
+namespace tl::memory {
+
+	/* Allocates memory of arbitrary size by rounding small sizes up to one of a set of size classes, each of which is served by a fixed_pool.
+		Thus allocations of small sizes get the thread-local caching and lock-free batched return of fixed_pool, without each size needing its
+		own pool type. Sizes larger than max_size, or alignments larger than alignment, are served by operator new.
+		The size passed to deallocate() must equal the size passed to the corresponding allocate(). */
+	class size_class_pool {
+	public:
+		/* Static variables */
+
+		// Granularity of the size classes in bytes; size classes are all the multiples of this up to max_size.
+		static constexpr std::size_t granularity = alignof(std::max_align_t);
+
+		// Largest size in bytes served from a pool.
+		static constexpr std::size_t max_size = 16 * granularity;
+
+		// Alignment of all memory served from a pool.
+		static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+
+		/* Static functions */
+
+		// Allocates size bytes aligned to align bytes.
+		static void* allocate(std::size_t size, std::size_t align = alignment)
+		{
+			if (_is_pooled(size, align)) {
+				return _functions<_class_sequence>::allocate[_size_class(size)]();
+			}
+			else {
+				return ::operator new(size, std::align_val_t(align));
+			}
+		}
+
+		// Deallocates memory previously obtained from allocate() with the same size and alignment (possibly on another thread).
+		static void deallocate(void* ptr, std::size_t size, std::size_t align = alignment)
+		{
+			if (_is_pooled(size, align)) {
+				_functions<_class_sequence>::deallocate[_size_class(size)](ptr);
+			}
+			else {
+				::operator delete(ptr, size, std::align_val_t(align));
+			}
+		}
+
+
+	private:
+		/* Member types */
+
+		// Indices of all the size classes.
+		using _class_sequence = std::make_index_sequence<max_size / granularity>;
+
+		// Tables of the allocation and deallocation functions of each size class's pool.
+		template<typename Sequence>
+		struct _functions;
+
+		template<std::size_t... Class>
+		struct _functions<std::index_sequence<Class...>> {
+			static constexpr void* (*allocate[])() = {&fixed_pool<(Class + 1) * granularity, alignment>::allocate...};
+			static constexpr void (*deallocate[])(void*) = {&fixed_pool<(Class + 1) * granularity, alignment>::deallocate...};
+		};
+
+
+		/* Static functions */
+
+		// Returns true if an allocation of the given size and alignment is served from a pool, otherwise false.
+		static constexpr bool _is_pooled(std::size_t size, std::size_t align)
+		{
+			return size != 0 && size <= max_size && align <= alignment;
+		}
+
+		// Gets the index of the smallest size class which fits size bytes (which must be nonzero).
+		static constexpr std::size_t _size_class(std::size_t size)
+		{
+			return (size - 1) / granularity;
+		}
+	};
+
+}
+
+
+#endif
@@ -0,0 +1,163 @@
+#ifndef TL_MEMORY_TRACKING_ALLOCATOR_HPP
+#define TL_MEMORY_TRACKING_ALLOCATOR_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <memory>			// std::allocator_traits
+#include <tuple>			// std::tuple
+#include <type_traits>		// std::enable_if_t
+#include <utility>			// std::forward, std::swap
+
+#include <tl/memory/allocation_tracker.hpp>		// tl::memory::allocation_statistics, tl::memory::allocation_tracker
+#include <tl/memory/uses_default_construct.hpp>	// tl::memory::uses_default_construct, tl::memory::detail::allocator_has_construct
+#include <tl/memory/uses_default_destroy.hpp>		// tl::memory::uses_default_destroy, tl::memory::detail::allocator_has_destroy
+
+
+namespace tl::memory {
+
+	/* Allocator adaptor which allocates with an allocator of type Inner, and records every allocation and deallocation with
+		allocation_tracker<Tag>. Different Tag types (eg. one per call site or subsystem) keep separate statistics; rebinding preserves the Tag,
+		so all the allocations of a container (including its internal nodes or shared state) are counted together.
+		Recording is thread-local, so the overhead is a few non-contended memory operations per allocation.
+		Construction and destruction are only provided if Inner provides them, and are then forwarded to Inner, as is copy construction of
+		containers. So wrapping an allocator which customises them (eg. std::scoped_allocator_adaptor) does not change its behaviour, and
+		uses_default_construct and uses_default_destroy are the same as for Inner, so the fast paths of memory algorithms remain in use. */
+	template<class Inner, typename Tag = void>
+	class tracking_allocator {
+	public:
+		/* Member types */
+
+		using inner_allocator_type = Inner;
+		using tracker_type = allocation_tracker<Tag>;
+		using value_type = typename std::allocator_traits<Inner>::value_type;
+		using pointer = typename std::allocator_traits<Inner>::pointer;
+		using const_pointer = typename std::allocator_traits<Inner>::const_pointer;
+		using void_pointer = typename std::allocator_traits<Inner>::void_pointer;
+		using const_void_pointer = typename std::allocator_traits<Inner>::const_void_pointer;
+		using size_type = typename std::allocator_traits<Inner>::size_type;
+		using difference_type = typename std::allocator_traits<Inner>::difference_type;
+		using propagate_on_container_copy_assignment = typename std::allocator_traits<Inner>::propagate_on_container_copy_assignment;
+		using propagate_on_container_move_assignment = typename std::allocator_traits<Inner>::propagate_on_container_move_assignment;
+		using propagate_on_container_swap = typename std::allocator_traits<Inner>::propagate_on_container_swap;
+		using is_always_equal = typename std::allocator_traits<Inner>::is_always_equal;
+
+		template<typename U>
+		struct rebind {
+			using other = tracking_allocator<typename std::allocator_traits<Inner>::template rebind_alloc<U>, Tag>;
+		};
+
+
+		/* Special members */
+
+		// Constructs the inner allocator from the given value.
+		tracking_allocator(Inner inner = Inner()) :
+			_inner(inner)
+		{}
+
+		// Constructs the inner allocator from other's inner allocator.
+		template<class OtherInner>
+		tracking_allocator(tracking_allocator<OtherInner, Tag> const& other) :
+			_inner(other.inner_allocator())
+		{}
+
+
+		/* General functions */
+
+		// Allocates storage for n objects with the inner allocator, and records the allocation.
+		pointer allocate(size_type n)
+		{
+			pointer const ptr = std::allocator_traits<Inner>::allocate(_inner, n);
+			tracker_type::record_allocation(n * sizeof(value_type));
+			return ptr;
+		}
+
+		// Constructs an object of type U at ptr from args, with the inner allocator. Only provided if the inner allocator provides construct.
+		template<typename U, typename... Args>
+		std::enable_if_t<detail::allocator_has_construct<Inner, U*, std::tuple<Args&&...>>::value> construct(U* ptr, Args&&... args)
+		{
+			std::allocator_traits<Inner>::construct(_inner, ptr, std::forward<Args>(args)...);
+		}
+
+		// Deallocates storage for n objects with the inner allocator, and records the deallocation.
+		void deallocate(pointer ptr, size_type n)
+		{
+			std::allocator_traits<Inner>::deallocate(_inner, ptr, n);
+			tracker_type::record_deallocation(n * sizeof(value_type));
+		}
+
+		// Destroys the object of type U at ptr, with the inner allocator. Only provided if the inner allocator provides destroy.
+		template<typename U>
+		std::enable_if_t<detail::allocator_has_destroy<Inner, U*>::value> destroy(U* ptr)
+		{
+			std::allocator_traits<Inner>::destroy(_inner, ptr);
+		}
+
+		// Gets the inner allocator.
+		Inner const& inner_allocator() const
+		{
+			return _inner;
+		}
+
+		// Gets the allocator to be used by a copy of a container using this allocator, as determined by the inner allocator.
+		tracking_allocator select_on_container_copy_construction() const
+		{
+			return tracking_allocator(std::allocator_traits<Inner>::select_on_container_copy_construction(_inner));
+		}
+
+
+		/* Static functions */
+
+		// Gets the statistics of all allocations recorded by tracking_allocators with the same Tag.
+		static allocation_statistics statistics()
+		{
+			return tracker_type::statistics();
+		}
+
+
+		/* Friend functions */
+
+		// Swaps the inner allocators of first and second.
+		friend void swap(tracking_allocator& first, tracking_allocator& second)
+		{
+			using std::swap;
+
+			swap(first._inner, second._inner);
+		}
+
+
+	private:
+		/* Variables */
+
+		// Allocator to which allocations are forwarded.
+		Inner _inner;
+	};
+
+
+	// Returns true if the inner allocators of lhs and rhs are equal, otherwise false.
+	template<class InnerT, class InnerU, typename Tag>
+	bool operator==(tracking_allocator<InnerT, Tag> const& lhs, tracking_allocator<InnerU, Tag> const& rhs)
+	{
+		return lhs.inner_allocator() == rhs.inner_allocator();
+	}
+
+	// Returns false if the inner allocators of lhs and rhs are equal, otherwise true.
+	template<class InnerT, class InnerU, typename Tag>
+	bool operator!=(tracking_allocator<InnerT, Tag> const& lhs, tracking_allocator<InnerU, Tag> const& rhs)
+	{
+		return !(lhs == rhs);
+	}
+
+
+	// Specialization for tracking_allocator, which constructs exactly as its inner allocator does.
+	template<class Inner, typename Tag, typename T, typename... Args>
+	struct uses_default_construct<tracking_allocator<Inner, Tag>, T, Args...> : uses_default_construct<Inner, T, Args...> {};
+
+
+	// Specialization for tracking_allocator, which destroys exactly as its inner allocator does.
+	template<class Inner, typename Tag, typename T>
+	struct uses_default_destroy<tracking_allocator<Inner, Tag>, T> : uses_default_destroy<Inner, T> {};
+
+}
+
+
+#endif
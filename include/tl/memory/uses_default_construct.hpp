@@ -0,0 +1,44 @@
+#ifndef TL_MEMORY_USES_DEFAULT_CONSTRUCT_HPP
+#define TL_MEMORY_USES_DEFAULT_CONSTRUCT_HPP
+
+
+#include <memory>			// std::allocator
+#include <tuple>			// std::tuple
+#include <type_traits>		// std::bool_constant, std::false_type, std::true_type, std::void_t
+#include <utility>			// std::declval
+
+#include <tl/type_support/is_class_template_instance.hpp>		// tl::type_support::is_class_template_instance_v
+
+
+namespace tl::memory {
+
+	namespace detail {
+
+		// Matches if Allocator does not have a member function construct callable with Pointer and Args.
+		template<class Allocator, typename Pointer, class ArgsTuple, typename = std::void_t<>>
+		struct allocator_has_construct : std::false_type {};
+
+
+		// Matches if Allocator has a member function construct callable with Pointer and Args.
+		template<class Allocator, typename Pointer, typename... Args>
+		struct allocator_has_construct<Allocator, Pointer, std::tuple<Args...>,
+			std::void_t<decltype(std::declval<Allocator&>().construct(std::declval<Pointer>(), std::declval<Args>()...))>> : std::true_type {};
+
+	}
+
+
+	/* std::true_type if std::allocator_traits<Allocator>::construct, called with a T* and Args, is equivalent to placement new, otherwise
+		std::false_type. This is the case if Allocator is a std::allocator, or if it does not provide its own construct member function.
+		If true, construction may bypass the allocator, for example to make use of the standard library's optimised algorithms. */
+	template<class Allocator, typename T, typename... Args>
+	struct uses_default_construct : std::bool_constant<type_support::is_class_template_instance_v<Allocator, std::allocator>
+		|| !detail::allocator_has_construct<Allocator, T*, std::tuple<Args...>>::value> {};
+
+
+	template<class Allocator, typename T, typename... Args>
+	inline constexpr bool uses_default_construct_v = uses_default_construct<Allocator, T, Args...>::value;
+
+}
+
+
+#endif
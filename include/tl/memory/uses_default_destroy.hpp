@@ -0,0 +1,42 @@
+#ifndef TL_MEMORY_USES_DEFAULT_DESTROY_HPP
+#define TL_MEMORY_USES_DEFAULT_DESTROY_HPP
+
+
+#include <memory>			// std::allocator
+#include <type_traits>		// std::bool_constant, std::false_type, std::true_type, std::void_t
+#include <utility>			// std::declval
+
+#include <tl/type_support/is_class_template_instance.hpp>		// tl::type_support::is_class_template_instance_v
+
+
+namespace tl::memory {
+
+	namespace detail {
+
+		// Matches if Allocator does not have a member function destroy callable with Pointer.
+		template<class Allocator, typename Pointer, typename = std::void_t<>>
+		struct allocator_has_destroy : std::false_type {};
+
+
+		// Matches if Allocator has a member function destroy callable with Pointer.
+		template<class Allocator, typename Pointer>
+		struct allocator_has_destroy<Allocator, Pointer, std::void_t<decltype(std::declval<Allocator&>().destroy(std::declval<Pointer>()))>>
+			: std::true_type {};
+
+	}
+
+
+	/* std::true_type if std::allocator_traits<Allocator>::destroy, called with a T*, is equivalent to calling the destructor directly, otherwise
+		std::false_type. This is the case if Allocator is a std::allocator, or if it does not provide its own destroy member function. */
+	template<class Allocator, typename T>
+	struct uses_default_destroy : std::bool_constant<type_support::is_class_template_instance_v<Allocator, std::allocator>
+		|| !detail::allocator_has_destroy<Allocator, T*>::value> {};
+
+
+	template<class Allocator, typename T>
+	inline constexpr bool uses_default_destroy_v = uses_default_destroy<Allocator, T>::value;
+
+}
+
+
+#endif
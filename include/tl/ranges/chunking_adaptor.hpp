@@ -0,0 +1,154 @@
+#ifndef TL_RANGES_CHUNKING_ADAPTOR_HPP
+#define TL_RANGES_CHUNKING_ADAPTOR_HPP
+
+
+#include <algorithm>		// std::max, std::min
+#include <cstddef>			// std::size_t
+#include <iterator>			// std::begin, std::end
+
+#include <tl/iterators/chunking_iterator.hpp>		// tl::iterators::chunking_iterator
+#include <tl/ranges/adaptor_base.hpp>				// tl::ranges::adaptor_base
+
+
+namespace tl::ranges {
+
+	/* Range adaptor that divides a range into contiguous chunks, each of which is an iterator_range of the base range's iterators.
+		The range is divided into at most the given number of chunks, such that each chunk has at least grain elements (except when the range
+		itself has fewer), and the chunks differ in size by at most 1 (see execution::static_partition). An empty range has no chunks.
+		The base range must have random access iterators and a known size (ie. its end can be subtracted from its begin), so each chunk is
+		obtained in constant time. This suits transforming_adaptor, reversing_adaptor and zipping_adaptor over such ranges, for example.
+		Chunks are independent, so may be processed by different threads, or sized to fit in cache. */
+	template<class Range>
+	class chunking_adaptor : public adaptor_base<chunking_adaptor<Range>> {
+	public:
+		/* Member types */
+
+		using range_type = Range;
+
+
+		/* Special members */
+
+		// Destructs the base range.
+		~chunking_adaptor() = default;
+
+		// Value-initializes the base range, and divides it into at most 1 chunk.
+		chunking_adaptor() :
+			_base(),
+			_max_chunks(1),
+			_grain(1)
+		{}
+
+		// Copy-constructs the base range, maximum number of chunks and grain size from those of other.
+		chunking_adaptor(chunking_adaptor const& other) = default;
+
+		// Move-constructs the base range, maximum number of chunks and grain size from those of other.
+		chunking_adaptor(chunking_adaptor&& other) = default;
+
+		/* Constructs the base range from the given value, to be divided into at most max_chunks chunks (which must be positive) of at least grain
+			elements each. */
+		chunking_adaptor(Range base, std::size_t max_chunks, std::size_t grain = 1) :
+			_base(base),
+			_max_chunks(max_chunks),
+			_grain(std::max<std::size_t>(grain, 1))
+		{}
+
+
+		/* Operators */
+
+		// Copy-assigns the base range, maximum number of chunks and grain size from those of rhs.
+		chunking_adaptor& operator=(chunking_adaptor const& rhs) = default;
+
+		// Move-assigns the base range, maximum number of chunks and grain size from those of rhs.
+		chunking_adaptor& operator=(chunking_adaptor&& rhs) = default;
+
+		// Gets the chunk with the given index, which must be less than size().
+		auto operator[](std::size_t i) const
+		{
+			auto const first = this->begin();
+			return first[static_cast<typename decltype(first)::difference_type>(i)];
+		}
+
+
+		/* General functions */
+
+		// Gets the base range.
+		Range const& base() const
+		{
+			return _base;
+		}
+
+		// Gets the number of chunks.
+		std::size_t size() const
+		{
+			return _chunk_count(static_cast<std::size_t>(std::end(_base) - std::begin(_base)));
+		}
+
+
+	protected:
+		/* General functions */
+
+		// Gets a (const) iterator to the first chunk.
+		template<class ChunkingAdaptor>
+		static auto _begin(ChunkingAdaptor& r)
+		{
+			return _iterator(r, false);
+		}
+
+		// Gets a (const) iterator to one past the last chunk.
+		template<class ChunkingAdaptor>
+		static auto _end(ChunkingAdaptor& r)
+		{
+			return _iterator(r, true);
+		}
+
+
+	private:
+		/* Static functions */
+
+		// Gets an iterator to the first chunk of r, or one past the last chunk if end is true.
+		template<class ChunkingAdaptor>
+		static auto _iterator(ChunkingAdaptor& r, bool end)
+		{
+			auto first = std::begin(r._base);
+			std::size_t const size = static_cast<std::size_t>(std::end(r._base) - first);
+			std::size_t const chunks = r._chunk_count(size);
+
+			using iterator = iterators::chunking_iterator<decltype(first)>;
+			return iterator(first, size, chunks, end ? static_cast<typename iterator::difference_type>(chunks) : 0);
+		}
+
+
+		/* General functions */
+
+		// Gets the number of chunks into which a range of the given size is divided.
+		std::size_t _chunk_count(std::size_t size) const
+		{
+			// Rounding down ensures every chunk has at least _grain elements, but a non-empty range always has at least one chunk.
+			return std::min(_max_chunks, std::max<std::size_t>(size / _grain, size != 0));
+		}
+
+
+		/* Variables */
+
+		Range _base;
+
+		// Maximum number of chunks.
+		std::size_t _max_chunks;
+
+		// Minimum number of elements in each chunk.
+		std::size_t _grain;
+	};
+
+
+	/* Divides range into at most max_chunks contiguous chunks of at least grain elements each, as a chunking_adaptor.
+		Each chunk is an iterator_range of range's iterators. */
+	template<class Range>
+	chunking_adaptor<Range> split(Range range, std::size_t max_chunks, std::size_t grain = 1)
+	{
+		return chunking_adaptor<Range>(range, max_chunks, grain);
+	}
+
+}
+
+
+#endif
@@ -3,20 +3,61 @@
 
 
 #include <algorithm>		// std::copy
+#include <cstddef>			// std::size_t
+#include <cstring>			// std::memmove
 #include <execution>		// std::is_execution_policy_v
-#include <iterator>			// std::begin, std::end
-#include <type_traits>		// std::decay_t, std::enable_if_t
-#include <utility>			// std::forward
+#include <iterator>			// std::begin, std::end, std::iterator_traits
+#include <memory>			// std::addressof
+#include <type_traits>		// std::conjunction_v, std::decay_t, std::enable_if_t, std::is_assignable, std::is_same, std::is_trivially_copyable
+#include <utility>			// std::declval, std::forward
+
+#include <tl/execution/pool_policy.hpp>						// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>					// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>						// tl::ranges::iterator_range
+#include <tl/type_support/is_contiguous_iterator.hpp>		// tl::type_support::is_contiguous_iterator
+#include <tl/type_support/is_remove_cv_same.hpp>			// tl::type_support::is_remove_cv_same
 
 
 namespace tl::ranges {
 
+	namespace detail {
+
+		/* true if the elements of a range with iterator type InputIterator and sentinel type Sentinel can be copied to a range with iterator
+			type OutputIterator with memmove, otherwise false. */
+		template<typename InputIterator, typename Sentinel, typename OutputIterator>
+		inline constexpr bool is_memmove_copyable_v = std::conjunction_v<
+			std::is_same<InputIterator, Sentinel>,
+			type_support::is_contiguous_iterator<InputIterator>,
+			type_support::is_contiguous_iterator<OutputIterator>,
+			type_support::is_remove_cv_same<typename std::iterator_traits<InputIterator>::value_type,
+				typename std::iterator_traits<OutputIterator>::value_type>,
+			std::is_trivially_copyable<typename std::iterator_traits<InputIterator>::value_type>,
+			std::is_assignable<decltype(*std::declval<OutputIterator>()), decltype(*std::declval<InputIterator>())>>;
+
+	}
+
+
 	/* Copies the elements of src to dst.
-		This simply provides a range-based interface for std::copy, see that documentation for exact semantics. */
+		This simply provides a range-based interface for std::copy, see that documentation for exact semantics.
+		If both ranges are contiguous (as determined by type_support::is_contiguous_iterator, which sees through adaptors such as
+		identity_adaptor, const_adaptor and iterator_range) and the elements are trivially copyable objects of the same type, the elements are
+		copied with a single memmove. */
 	template<class InputRange, class OutputRange>
 	void copy(InputRange&& src, OutputRange&& dst)
 	{
-		std::copy(std::begin(src), std::end(src), std::begin(dst));
+		auto first = std::begin(src);
+		auto last = std::end(src);
+		auto d_first = std::begin(dst);
+
+		if constexpr (detail::is_memmove_copyable_v<decltype(first), decltype(last), decltype(d_first)>) {
+			if (first != last) {
+				using value_type = typename std::iterator_traits<decltype(first)>::value_type;
+				std::memmove(std::addressof(*d_first), std::addressof(*first), static_cast<std::size_t>(last - first) * sizeof(value_type));
+			}
+		}
+		else {
+			std::copy(first, last, d_first);
+		}
 	}
 
 
@@ -29,6 +70,30 @@ namespace tl::ranges {
 		std::copy(std::forward<ExecutionPolicy>(exec_policy), std::begin(src), std::end(src), std::begin(dst));
 	}
 
+
+	/* Copies the elements of src to dst, on the thread pool of exec_policy (see execution::pool_policy).
+		Each chunk of src is copied by one task, with the sequential copy above (so contiguous chunks of trivially copyable elements are copied
+		with memmove). The ranges must not overlap, and dst must have random access iterators. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		copy(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst)
+	{
+		auto const s_first = std::begin(src);
+		auto const d_first = std::begin(dst);
+		auto const chunks = split(iterator_range(s_first, std::end(src)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			copy(src, dst);
+			return;
+		}
+
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto const d_chunk = d_first + (std::begin(chunk) - s_first);
+			copy(chunk, iterator_range(d_chunk, d_chunk + (std::end(chunk) - std::begin(chunk))));
+		});
+	}
+
 }
 
 
@@ -0,0 +1,92 @@
+#ifndef TL_RANGES_EXCLUSIVE_SCAN_HPP
+#define TL_RANGES_EXCLUSIVE_SCAN_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <iterator>			// std::begin, std::end, std::next
+#include <numeric>			// std::accumulate, std::exclusive_scan
+#include <optional>			// std::optional
+#include <type_traits>		// std::decay_t, std::enable_if_t
+#include <utility>			// std::forward, std::move
+#include <vector>			// std::vector
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	/* Computes the exclusive prefix sums of the elements of src over op, starting from init, and stores them in dst.
+		This simply provides a range-based interface for std::exclusive_scan, see that documentation for exact semantics. */
+	template<class InputRange, class OutputRange, typename T, typename BinaryOperation>
+	void exclusive_scan(InputRange&& src, OutputRange&& dst, T init, BinaryOperation op)
+	{
+		std::exclusive_scan(std::begin(src), std::end(src), std::begin(dst), init, op);
+	}
+
+
+	/* Computes the exclusive prefix sums of the elements of src over op, starting from init, and stores them in dst, executed according to
+		exec_policy.
+		This simply provides a range-based interface for std::exclusive_scan, see that documentation for exact semantics. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename T, typename BinaryOperation>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		exclusive_scan(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, T init, BinaryOperation op)
+	{
+		std::exclusive_scan(std::forward<ExecutionPolicy>(exec_policy), std::begin(src), std::end(src), std::begin(dst), init, op);
+	}
+
+
+	/* Computes the exclusive prefix sums of the elements of src over op, starting from init, and stores them in dst, on the thread pool of
+		exec_policy (see execution::pool_policy). op must be associative. dst must have random access iterators.
+		As with the parallel inclusive_scan, each chunk (but the last) is first reduced, then each chunk is scanned starting from the total of
+		init and the preceding chunks. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename T, typename BinaryOperation>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		exclusive_scan(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, T init, BinaryOperation op)
+	{
+		auto const s_first = std::begin(src);
+		auto const d_first = std::begin(dst);
+		auto const chunks = split(iterator_range(s_first, std::end(src)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			std::exclusive_scan(s_first, std::end(src), d_first, init, op);
+			return;
+		}
+
+		/* Each total is seeded with op applied to the chunk's first two elements, so (as with std::exclusive_scan) elements need not be
+			convertible to T. Chunks are never empty, but a chunk of one element has no total, and its element is used directly instead. */
+		std::vector<std::optional<T>> totals(count - 1);
+		exec_policy.run(count - 1, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto it = std::begin(chunk);
+			auto const second = std::next(it);
+			if (second != std::end(chunk)) {
+				T value = op(*it, *second);
+				totals[i].emplace(std::accumulate(std::next(second), std::end(chunk), std::move(value), op));
+			}
+		});
+
+		// offsets[i] is the total of init and the chunks before chunk i.
+		std::vector<std::optional<T>> offsets(count);
+		offsets[0].emplace(std::move(init));
+		for (std::size_t i = 1; i < count; ++i) {
+			if (totals[i - 1]) {
+				offsets[i].emplace(op(*offsets[i - 1], std::move(*totals[i - 1])));
+			}
+			else {
+				offsets[i].emplace(op(*offsets[i - 1], *std::begin(chunks[i - 1])));
+			}
+		}
+
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			std::exclusive_scan(std::begin(chunk), std::end(chunk), d_first + (std::begin(chunk) - s_first), *offsets[i], op);
+		});
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TL_RANGES_FOR_EACH_HPP
+#define TL_RANGES_FOR_EACH_HPP
+
+
+#include <algorithm>		// std::for_each
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <iterator>			// std::begin, std::end
+#include <type_traits>		// std::decay_t, std::enable_if_t
+#include <utility>			// std::forward
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	/* Calls f with each element of range, in order.
+		This simply provides a range-based interface for std::for_each, see that documentation for exact semantics. */
+	template<class InputRange, typename UnaryFunction>
+	void for_each(InputRange&& range, UnaryFunction f)
+	{
+		std::for_each(std::begin(range), std::end(range), f);
+	}
+
+
+	/* Calls f with each element of range, executed according to exec_policy.
+		This simply provides a range-based interface for std::for_each, see that documentation for exact semantics. */
+	template<class ExecutionPolicy, class InputRange, typename UnaryFunction>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		for_each(ExecutionPolicy&& exec_policy, InputRange&& range, UnaryFunction f)
+	{
+		std::for_each(std::forward<ExecutionPolicy>(exec_policy), std::begin(range), std::end(range), f);
+	}
+
+
+	/* Calls f with each element of range, on the thread pool of exec_policy (see execution::pool_policy).
+		Each chunk of the range is processed in order by one task, but chunks are processed concurrently, so f must be safe to call
+		concurrently. */
+	template<class ExecutionPolicy, class InputRange, typename UnaryFunction>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		for_each(ExecutionPolicy&& exec_policy, InputRange&& range, UnaryFunction f)
+	{
+		auto const chunks = split(iterator_range(std::begin(range), std::end(range)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			std::for_each(std::begin(range), std::end(range), f);
+			return;
+		}
+
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			std::for_each(std::begin(chunk), std::end(chunk), f);
+		});
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef TL_RANGES_FOR_EACH_BATCH_HPP
+#define TL_RANGES_FOR_EACH_BATCH_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <iterator>			// std::begin, std::end, std::iterator_traits
+#include <memory>			// std::addressof
+#include <tuple>			// std::apply
+#include <type_traits>		// std::false_type, std::true_type
+
+#include <tl/ranges/zipping_adaptor.hpp>					// tl::ranges::zipping_adaptor
+#include <tl/type_support/is_contiguous_iterator.hpp>		// tl::type_support::is_contiguous_iterator_v
+#include <tl/type_support/remove_cvref.hpp>					// tl::type_support::remove_cvref_t
+
+
+namespace tl::ranges {
+
+	namespace detail {
+
+		// Matches if Range is not a zipping_adaptor.
+		template<class Range>
+		struct is_zipping_adaptor : std::false_type {};
+
+
+		// Matches if Range is a zipping_adaptor.
+		template<class... Ranges>
+		struct is_zipping_adaptor<zipping_adaptor<Ranges...>> : std::true_type {};
+
+
+		// Gets the iterator at offset i from it.
+		template<typename Iterator>
+		Iterator offset(Iterator it, std::size_t i)
+		{
+			return it + static_cast<typename std::iterator_traits<Iterator>::difference_type>(i);
+		}
+
+		// Gets a pointer to the element at offset i from it if Iterator is contiguous, otherwise the iterator at offset i from it.
+		template<typename Iterator>
+		auto batch_position(Iterator it, std::size_t i)
+		{
+			if constexpr (type_support::is_contiguous_iterator_v<Iterator>) {
+				return std::addressof(*offset(it, i));
+			}
+			else {
+				return offset(it, i);
+			}
+		}
+
+		// Calls batch for each complete batch of Width elements in the size elements starting at firsts, then scalar for each remaining element.
+		template<std::size_t Width, typename BatchFunction, typename ScalarFunction, typename... Iterators>
+		void for_each_batch_impl(BatchFunction& batch, ScalarFunction& scalar, std::size_t size, Iterators... firsts)
+		{
+			std::size_t i = 0;
+			for (; size - i >= Width; i += Width) {
+				batch(batch_position(firsts, i)...);
+			}
+			for (; i < size; ++i) {
+				scalar(*offset(firsts, i)...);
+			}
+		}
+
+	}
+
+
+	/* Processes the elements of range in batches of Width consecutive elements, for kernels that operate on several elements at once (eg. with
+		SIMD instructions). range must have random access iterators and a known size.
+		For each complete batch, batch is called with a pointer to the first element of the batch if range is contiguous (see
+		type_support::is_contiguous_iterator), otherwise an iterator to it. The batch's elements are then the Width elements from that position.
+		For each of the remaining elements (fewer than Width), scalar is called with a reference to the element.
+		If range is a zipping_adaptor, its base ranges are processed together: batch is called with a pointer or iterator for each base range,
+		and scalar with a reference to the element of each base range. Since batch receives the underlying pointers, rather than elements
+		obtained through zipping or transforming iterators, its loops can be vectorised. */
+	template<std::size_t Width, class Range, typename BatchFunction, typename ScalarFunction>
+	void for_each_batch(Range&& range, BatchFunction batch, ScalarFunction scalar)
+	{
+		static_assert(Width > 0, "Batch width must be positive.");
+
+		if constexpr (detail::is_zipping_adaptor<type_support::remove_cvref_t<Range>>::value) {
+			std::size_t const size = static_cast<std::size_t>(range.size());
+			std::apply([&](auto... firsts) {
+					detail::for_each_batch_impl<Width>(batch, scalar, size, firsts...);
+				}, std::begin(range).base());
+		}
+		else {
+			auto const first = std::begin(range);
+			detail::for_each_batch_impl<Width>(batch, scalar, static_cast<std::size_t>(std::end(range) - first), first);
+		}
+	}
+
+}
+
+
+#endif
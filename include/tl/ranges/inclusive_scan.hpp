@@ -0,0 +1,91 @@
+#ifndef TL_RANGES_INCLUSIVE_SCAN_HPP
+#define TL_RANGES_INCLUSIVE_SCAN_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <iterator>			// std::begin, std::end, std::iterator_traits
+#include <numeric>			// std::accumulate, std::inclusive_scan
+#include <optional>			// std::optional
+#include <type_traits>		// std::decay_t, std::enable_if_t
+#include <utility>			// std::forward, std::move
+#include <vector>			// std::vector
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	/* Computes the inclusive prefix sums of the elements of src over op, and stores them in dst.
+		This simply provides a range-based interface for std::inclusive_scan, see that documentation for exact semantics. */
+	template<class InputRange, class OutputRange, typename BinaryOperation>
+	void inclusive_scan(InputRange&& src, OutputRange&& dst, BinaryOperation op)
+	{
+		std::inclusive_scan(std::begin(src), std::end(src), std::begin(dst), op);
+	}
+
+
+	/* Computes the inclusive prefix sums of the elements of src over op, and stores them in dst, executed according to exec_policy.
+		This simply provides a range-based interface for std::inclusive_scan, see that documentation for exact semantics. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename BinaryOperation>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		inclusive_scan(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, BinaryOperation op)
+	{
+		std::inclusive_scan(std::forward<ExecutionPolicy>(exec_policy), std::begin(src), std::end(src), std::begin(dst), op);
+	}
+
+
+	/* Computes the inclusive prefix sums of the elements of src over op, and stores them in dst, on the thread pool of exec_policy (see
+		execution::pool_policy). op must be associative. dst must have random access iterators.
+		The work is done in two parallel passes over the chunks of src: first each chunk (but the last) is reduced, then, after the prefix sums
+		of the chunk totals are computed on the calling thread, each chunk is scanned starting from the total of the preceding chunks. src is
+		therefore read twice, but dst is only written once. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename BinaryOperation>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		inclusive_scan(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, BinaryOperation op)
+	{
+		auto s_first = std::begin(src);
+		auto const d_first = std::begin(dst);
+		auto const chunks = split(iterator_range(s_first, std::end(src)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			std::inclusive_scan(s_first, std::end(src), d_first, op);
+			return;
+		}
+
+		using value_type = typename std::iterator_traits<decltype(s_first)>::value_type;
+
+		// Chunks are never empty, so each total starts from the chunk's first element.
+		std::vector<std::optional<value_type>> totals(count - 1);
+		exec_policy.run(count - 1, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto it = std::begin(chunk);
+			value_type value = *it;
+			totals[i].emplace(std::accumulate(++it, std::end(chunk), std::move(value), op));
+		});
+
+		// offsets[i] is the total of the chunks before chunk i + 1.
+		std::vector<std::optional<value_type>> offsets(count - 1);
+		offsets[0].emplace(std::move(*totals[0]));
+		for (std::size_t i = 1; i < count - 1; ++i) {
+			offsets[i].emplace(op(*offsets[i - 1], std::move(*totals[i])));
+		}
+
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto const d_chunk = d_first + (std::begin(chunk) - s_first);
+			if (i == 0) {
+				std::inclusive_scan(std::begin(chunk), std::end(chunk), d_chunk, op);
+			}
+			else {
+				std::inclusive_scan(std::begin(chunk), std::end(chunk), d_chunk, op, *offsets[i - 1]);
+			}
+		});
+	}
+
+}
+
+
+#endif
@@ -2,11 +2,18 @@
 #define TL_RANGES_REDUCE_HPP
 
 
+#include <cstddef>			// std::size_t
 #include <execution>		// std::is_execution_policy_v
-#include <iterator>			// std::begin, std::end
+#include <iterator>			// std::begin, std::end, std::next
 #include <numeric>			// std::reduce
+#include <optional>			// std::optional
 #include <type_traits>		// std::decay_t, std::enable_if_t
-#include <utility>			// std::forward
+#include <utility>			// std::forward, std::move
+#include <vector>			// std::vector
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
 
 
 namespace tl::ranges {
@@ -29,6 +36,45 @@ namespace tl::ranges {
 		return std::reduce(std::forward<ExecutionPolicy>(exec_policy), std::begin(range), std::end(range), init, op);
 	}
 
+
+	/* Reduces the elements of range, along with init, over op, on the thread pool of exec_policy (see execution::pool_policy).
+		Each chunk of the range is reduced by one task, then the partial results are reduced on the calling thread. As with std::reduce, op must
+		be associative and commutative, since the elements are not combined in order. */
+	template<class ExecutionPolicy, class InputRange, typename T, typename BinaryOperation>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, T>
+		reduce(ExecutionPolicy&& exec_policy, InputRange&& range, T init, BinaryOperation op)
+	{
+		auto const chunks = split(iterator_range(std::begin(range), std::end(range)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			return std::reduce(std::begin(range), std::end(range), init, op);
+		}
+
+		/* Each partial result is seeded with op applied to the chunk's first two elements, so (as with std::reduce) elements need not be
+			convertible to T. Chunks are never empty, but a chunk of one element has no partial result, and its element is combined with init
+			on the calling thread instead. */
+		std::vector<std::optional<T>> partials(count);
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto it = std::begin(chunk);
+			auto const second = std::next(it);
+			if (second != std::end(chunk)) {
+				T value = op(*it, *second);
+				partials[i].emplace(std::reduce(std::next(second), std::end(chunk), std::move(value), op));
+			}
+		});
+
+		for (std::size_t i = 0; i < count; ++i) {
+			if (partials[i]) {
+				init = op(std::move(init), std::move(*partials[i]));
+			}
+			else {
+				init = op(std::move(init), *std::begin(chunks[i]));
+			}
+		}
+		return init;
+	}
+
 }
 
 
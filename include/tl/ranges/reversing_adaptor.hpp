@@ -25,7 +25,7 @@ namespace tl::ranges {
 
 		// Value-initializes the base range.
 		reversing_adaptor() :
-			_range()
+			_base()
 		{}
 
 		// Copy-constructs the base range from that of other.
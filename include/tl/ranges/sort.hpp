@@ -0,0 +1,108 @@
+#ifndef TL_RANGES_SORT_HPP
+#define TL_RANGES_SORT_HPP
+
+
+#include <algorithm>		// std::inplace_merge, std::sort
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <functional>		// std::less
+#include <iterator>			// std::begin, std::end, std::iterator_traits
+#include <type_traits>		// std::decay_t, std::enable_if_t, std::is_reference_v
+#include <utility>			// std::forward
+#include <vector>			// std::vector
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/iterators/swappable_iterator.hpp>	// tl::iterators::swappable_iterator
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	namespace detail {
+
+		// true if T is a standard execution policy or execution::pool_policy, otherwise false.
+		template<typename T>
+		inline constexpr bool is_any_execution_policy_v = std::is_execution_policy_v<T> || execution::is_pool_policy_v<T>;
+
+		/* Gets an iterator through which std algorithms can sort the elements from it: it itself if it dereferences to a reference, otherwise
+			(eg. for zipping_adaptor, which dereferences to a tuple of references) it wrapped in an iterators::swappable_iterator. */
+		template<typename Iterator>
+		auto sortable(Iterator it)
+		{
+			if constexpr (std::is_reference_v<typename std::iterator_traits<Iterator>::reference>) {
+				return it;
+			}
+			else {
+				return iterators::swappable_iterator<Iterator>(it);
+			}
+		}
+
+	}
+
+
+	/* Sorts the elements of range in ascending order according to comp.
+		This simply provides a range-based interface for std::sort, see that documentation for exact semantics. Ranges whose iterators dereference
+		to a proxy (eg. zipping_adaptor) can also be sorted, in which case comp is given the proxies. */
+	template<class RandomAccessRange, typename Compare = std::less<>>
+	std::enable_if_t<!detail::is_any_execution_policy_v<std::decay_t<RandomAccessRange>>, void>
+		sort(RandomAccessRange&& range, Compare comp = Compare())
+	{
+		std::sort(detail::sortable(std::begin(range)), detail::sortable(std::end(range)), comp);
+	}
+
+
+	/* Sorts the elements of range in ascending order according to comp, executed according to exec_policy.
+		This simply provides a range-based interface for std::sort, see that documentation for exact semantics. As with the sequential overload,
+		ranges whose iterators dereference to a proxy can also be sorted. */
+	template<class ExecutionPolicy, class RandomAccessRange, typename Compare = std::less<>>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		sort(ExecutionPolicy&& exec_policy, RandomAccessRange&& range, Compare comp = Compare())
+	{
+		std::sort(std::forward<ExecutionPolicy>(exec_policy), detail::sortable(std::begin(range)), detail::sortable(std::end(range)), comp);
+	}
+
+
+	/* Sorts the elements of range in ascending order according to comp, on the thread pool of exec_policy (see execution::pool_policy).
+		Each chunk of the range is sorted by one task, then adjacent runs are merged in pairs with std::inplace_merge, with the merges of each
+		round running in parallel, until one sorted run remains. As with the sequential overload, ranges whose iterators dereference to a proxy can
+		also be sorted. */
+	template<class ExecutionPolicy, class RandomAccessRange, typename Compare = std::less<>>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		sort(ExecutionPolicy&& exec_policy, RandomAccessRange&& range, Compare comp = Compare())
+	{
+		auto first = detail::sortable(std::begin(range));
+		auto last = detail::sortable(std::end(range));
+		auto const chunks = split(iterator_range(first, last), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			std::sort(first, last, comp);
+			return;
+		}
+
+		// bounds[i] is the iterator to the first element of chunk i, and bounds[count] is the end of the range.
+		std::vector<decltype(first)> bounds(count + 1);
+		for (std::size_t i = 0; i < count; ++i) {
+			bounds[i] = std::begin(chunks[i]);
+		}
+		bounds[count] = std::end(chunks[count - 1]);
+
+		exec_policy.run(count, [&](std::size_t i) {
+			std::sort(bounds[i], bounds[i + 1], comp);
+		});
+
+		// Each round merges pairs of adjacent sorted runs of width chunks into runs of 2 * width chunks.
+		for (std::size_t width = 1; width < count; width *= 2) {
+			std::size_t const merges = (count - width + 2 * width - 1) / (2 * width);
+			exec_policy.run(merges, [&](std::size_t i) {
+				std::size_t const low = 2 * width * i;
+				std::size_t const high = low + 2 * width < count ? low + 2 * width : count;
+				std::inplace_merge(bounds[low], bounds[low + width], bounds[high], comp);
+			});
+		}
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef TL_RANGES_TRANSFORM_HPP
+#define TL_RANGES_TRANSFORM_HPP
+
+
+#include <algorithm>		// std::transform
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <iterator>			// std::begin, std::end
+#include <type_traits>		// std::decay_t, std::enable_if_t
+#include <utility>			// std::forward
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	/* Transforms each element of src with op, and stores the results in dst.
+		This simply provides a range-based interface for std::transform, see that documentation for exact semantics. */
+	template<class InputRange, class OutputRange, typename UnaryOperation>
+	void transform(InputRange&& src, OutputRange&& dst, UnaryOperation op)
+	{
+		std::transform(std::begin(src), std::end(src), std::begin(dst), op);
+	}
+
+
+	/* Transforms each element of src with op, and stores the results in dst, executed according to exec_policy.
+		This simply provides a range-based interface for std::transform, see that documentation for exact semantics. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename UnaryOperation>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		transform(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, UnaryOperation op)
+	{
+		std::transform(std::forward<ExecutionPolicy>(exec_policy), std::begin(src), std::end(src), std::begin(dst), op);
+	}
+
+
+	/* Transforms each element of src with op, and stores the results in dst, on the thread pool of exec_policy (see
+		execution::pool_policy).
+		Each chunk of src is transformed by one task, so op must be safe to call concurrently. dst must have random access iterators. */
+	template<class ExecutionPolicy, class InputRange, class OutputRange, typename UnaryOperation>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, void>
+		transform(ExecutionPolicy&& exec_policy, InputRange&& src, OutputRange&& dst, UnaryOperation op)
+	{
+		auto const s_first = std::begin(src);
+		auto const d_first = std::begin(dst);
+		auto const chunks = split(iterator_range(s_first, std::end(src)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			std::transform(s_first, std::end(src), d_first, op);
+			return;
+		}
+
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			std::transform(std::begin(chunk), std::end(chunk), d_first + (std::begin(chunk) - s_first), op);
+		});
+	}
+
+}
+
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef TL_RANGES_TRANSFORM_REDUCE_HPP
+#define TL_RANGES_TRANSFORM_REDUCE_HPP
+
+
+#include <cstddef>			// std::size_t
+#include <execution>		// std::is_execution_policy_v
+#include <iterator>			// std::begin, std::end, std::next
+#include <numeric>			// std::transform_reduce
+#include <optional>			// std::optional
+#include <type_traits>		// std::decay_t, std::enable_if_t
+#include <utility>			// std::forward, std::move
+#include <vector>			// std::vector
+
+#include <tl/execution/pool_policy.hpp>			// tl::execution::is_pool_policy_v
+#include <tl/ranges/chunking_adaptor.hpp>		// tl::ranges::split
+#include <tl/ranges/iterator_range.hpp>			// tl::ranges::iterator_range
+
+
+namespace tl::ranges {
+
+	/* Transforms each element of range with transform_op, then reduces the results, along with init, over reduce_op.
+		This simply provides a range-based interface for std::transform_reduce, see that documentation for exact semantics.
+		Each element is transformed as it is reduced, so no intermediate range is materialised. To combine elements of several ranges (eg. a
+		dot product), pass a zipping_adaptor and a transform_op taking a tuple of references. */
+	template<class InputRange, typename T, typename BinaryOperation, typename UnaryOperation>
+	T transform_reduce(InputRange&& range, T init, BinaryOperation reduce_op, UnaryOperation transform_op)
+	{
+		return std::transform_reduce(std::begin(range), std::end(range), init, reduce_op, transform_op);
+	}
+
+
+	/* Transforms each element of range with transform_op, then reduces the results, along with init, over reduce_op, executed according to
+		exec_policy.
+		This simply provides a range-based interface for std::transform_reduce, see that documentation for exact semantics. */
+	template<class ExecutionPolicy, class InputRange, typename T, typename BinaryOperation, typename UnaryOperation>
+	std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, T>
+		transform_reduce(ExecutionPolicy&& exec_policy, InputRange&& range, T init, BinaryOperation reduce_op, UnaryOperation transform_op)
+	{
+		return std::transform_reduce(std::forward<ExecutionPolicy>(exec_policy), std::begin(range), std::end(range), init, reduce_op,
+			transform_op);
+	}
+
+
+	/* Transforms each element of range with transform_op, then reduces the results, along with init, over reduce_op, on the thread pool of
+		exec_policy (see execution::pool_policy).
+		Each chunk of the range is transformed and reduced in a single pass by one task, then the partial results are reduced on the calling
+		thread. As with std::transform_reduce, reduce_op must be associative and commutative. */
+	template<class ExecutionPolicy, class InputRange, typename T, typename BinaryOperation, typename UnaryOperation>
+	std::enable_if_t<execution::is_pool_policy_v<std::decay_t<ExecutionPolicy>>, T>
+		transform_reduce(ExecutionPolicy&& exec_policy, InputRange&& range, T init, BinaryOperation reduce_op, UnaryOperation transform_op)
+	{
+		auto const chunks = split(iterator_range(std::begin(range), std::end(range)), exec_policy.max_chunks(), exec_policy.grain());
+		std::size_t const count = chunks.size();
+		if (count <= 1) {
+			return std::transform_reduce(std::begin(range), std::end(range), init, reduce_op, transform_op);
+		}
+
+		/* Each partial result is seeded with reduce_op applied to the chunk's first two transformed elements, so (as with
+			std::transform_reduce) transformed elements need not be convertible to T. Chunks are never empty, but a chunk of one element has no
+			partial result, and its transformed element is combined with init on the calling thread instead. */
+		std::vector<std::optional<T>> partials(count);
+		exec_policy.run(count, [&](std::size_t i) {
+			auto const chunk = chunks[i];
+			auto it = std::begin(chunk);
+			auto const second = std::next(it);
+			if (second != std::end(chunk)) {
+				T value = reduce_op(transform_op(*it), transform_op(*second));
+				partials[i].emplace(std::transform_reduce(std::next(second), std::end(chunk), std::move(value), reduce_op, transform_op));
+			}
+		});
+
+		for (std::size_t i = 0; i < count; ++i) {
+			if (partials[i]) {
+				init = reduce_op(std::move(init), std::move(*partials[i]));
+			}
+			else {
+				init = reduce_op(std::move(init), transform_op(*std::begin(chunks[i])));
+			}
+		}
+		return init;
+	}
+
+}
+
+
+#endif
@@ -2,20 +2,52 @@
 #define TL_RANGES_ZIPPING_ADAPTOR_HPP
 
 
-#include <iterator>			// std::begin, std::end
-#include <tuple>			// std::tuple
+#include <algorithm>		// std::min
+#include <cstddef>			// std::size_t
+#include <iterator>			// std::begin, std::end, std::iterator_traits, std::random_access_iterator_tag
+#include <tuple>			// std::apply, std::tuple
+#include <type_traits>		// std::common_type_t, std::conjunction_v, std::is_base_of
 
-#include <tl/iterators/zipping_iterator.hpp>	// tl::iterators::zipping_iterator
-#include <tl/ranges/adaptor_base.hpp>			// tl::ranges::adaptor_base
-#include <tl/tuple/transform.hpp>				// tl::tuple::transform
+#include <tl/iterators/indexed_zipping_iterator.hpp>	// tl::iterators::indexed_zipping_iterator
+#include <tl/iterators/zipping_iterator.hpp>			// tl::iterators::zipping_iterator
+#include <tl/ranges/adaptor_base.hpp>					// tl::ranges::adaptor_base
+#include <tl/ranges/range_traits.hpp>					// tl::ranges::range_traits
+#include <tl/tuple/transform.hpp>						// tl::tuple::transform
+#include <tl/type_support/is_subtractable.hpp>			// tl::type_support::is_subtractable
 
 
 namespace tl::ranges {
 
-	// Range adaptor that zips multiple ranges into a single range of tuples.
+	namespace detail {
+
+		// std::true_type if Range has random access iterators, and its sentinel can be subtracted from its iterator, otherwise std::false_type.
+		template<class Range>
+		struct is_sized_random_access_range : std::conjunction<
+			std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<typename range_traits<Range>::iterator>::iterator_category>,
+			type_support::is_subtractable<typename range_traits<Range>::sentinel, typename range_traits<Range>::iterator>> {};
+
+	}
+
+
+	/* Range adaptor that zips multiple ranges into a single range of tuples.
+		If all the ranges have random access iterators and known sizes (ie. their sentinels can be subtracted from their iterators), the zipped
+		range has the size of the smallest range, which is given by size(). Its iterators are indexed_zipping_iterators, so iterating only
+		increments and compares a single index, and the range can be partitioned in constant time.
+		Otherwise, its iterators are zipping_iterators, and the zipped range ends when any of the ranges ends. */
 	template<class... Ranges>
 	class zipping_adaptor : public adaptor_base<zipping_adaptor<Ranges...>> {
 	public:
+		/* Member types */
+
+		using size_type = std::common_type_t<std::size_t, typename std::iterator_traits<typename range_traits<Ranges>::iterator>::difference_type...>;
+
+
+		/* Static variables */
+
+		// true if all the ranges have random access iterators and known sizes, otherwise false.
+		static constexpr bool is_sized = std::conjunction_v<detail::is_sized_random_access_range<Ranges const>...>;
+
+
 		/* Special members */
 
 		// Destructs the base ranges.
@@ -60,6 +92,12 @@ namespace tl::ranges {
 			return _bases;
 		}
 
+		// Gets the number of elements in the zipped range, which is the smallest of the sizes of the base ranges. Only available if is_sized.
+		size_type size() const
+		{
+			return static_cast<size_type>(_size(*this));
+		}
+
 
 	protected:
 		/* General functions */
@@ -68,18 +106,50 @@ namespace tl::ranges {
 		template<class ZippingAdaptor>
 		static auto _begin(ZippingAdaptor& r)
 		{
-			return iterators::zipping_iterator(tuple::transform(r._bases, [](auto& base) { return std::begin(base); }));
+			auto begins = tuple::transform(r._bases, [](auto& base) { return std::begin(base); });
+			if constexpr (is_sized) {
+				return _indexed_iterator(begins, 0);
+			}
+			else {
+				return iterators::zipping_iterator(begins);
+			}
 		}
 
 		// Gets a (const) sentinel to the end of the zipped range.
 		template<class ZippingAdaptor>
 		static auto _end(ZippingAdaptor& r)
 		{
-			return iterators::zipping_iterator(tuple::transform(r._bases, [](auto& base) { return std::end(base); }));
+			if constexpr (is_sized) {
+				return _indexed_iterator(tuple::transform(r._bases, [](auto& base) { return std::begin(base); }), _size(r));
+			}
+			else {
+				return iterators::zipping_iterator(tuple::transform(r._bases, [](auto& base) { return std::end(base); }));
+			}
 		}
 
 
 	private:
+		/* Static functions */
+
+		// Gets the smallest of the sizes of r's base ranges.
+		template<class ZippingAdaptor>
+		static auto _size(ZippingAdaptor& r)
+		{
+			return std::apply([](auto&... bases) {
+					return std::min({static_cast<std::common_type_t<decltype(std::end(bases) - std::begin(bases))...>>(
+						std::end(bases) - std::begin(bases))...});
+				}, r._bases);
+		}
+
+		// Constructs an indexed_zipping_iterator from a tuple of iterators and an index.
+		template<typename... Iterators, typename Index>
+		static auto _indexed_iterator(std::tuple<Iterators...> bases, Index index)
+		{
+			using iterator = iterators::indexed_zipping_iterator<Iterators...>;
+			return iterator(bases, static_cast<typename iterator::difference_type>(index));
+		}
+
+
 		/* Variables */
 
 		std::tuple<Ranges...> _bases;
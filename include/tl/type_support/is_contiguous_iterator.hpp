@@ -0,0 +1,72 @@
+#ifndef TL_TYPE_SUPPORT_IS_CONTIGUOUS_ITERATOR_HPP
+#define TL_TYPE_SUPPORT_IS_CONTIGUOUS_ITERATOR_HPP
+
+
+#include <iterator>			// std::iterator_traits
+#include <string>			// std::basic_string
+#include <string_view>		// std::basic_string_view
+#include <type_traits>		// std::disjunction, std::enable_if_t, std::false_type, std::is_pointer, std::remove_cv_t, std::void_t
+#include <vector>			// std::vector
+
+#include <tl/type_support/is_any_of.hpp>		// tl::type_support::is_any_of, tl::type_support::is_any_of_v
+
+
+namespace tl::type_support {
+
+	namespace detail {
+
+		// Matches if Value is not a character type, so Iterator cannot be a string iterator.
+		template<typename Iterator, typename Value, typename = void>
+		struct is_string_iterator : std::false_type {};
+
+
+		// Matches if Value is a character type, so Iterator may be an iterator of std::basic_string or std::basic_string_view.
+		template<typename Iterator, typename Value>
+		struct is_string_iterator<Iterator, Value, std::enable_if_t<is_any_of_v<Value, char, wchar_t, char16_t, char32_t>>>
+			: is_any_of<Iterator, typename std::basic_string<Value>::iterator, typename std::basic_string<Value>::const_iterator,
+				typename std::basic_string_view<Value>::const_iterator> {};
+
+
+		// Matches if Iterator is a (const) iterator of std::vector or std::basic_string, with the given value type.
+		template<typename Iterator, typename Value>
+		struct is_standard_contiguous_iterator : std::disjunction<
+			is_any_of<Iterator, typename std::vector<Value>::iterator, typename std::vector<Value>::const_iterator>,
+			is_string_iterator<Iterator, Value>> {};
+
+
+		// Matches std::vector<bool>, whose elements are not stored contiguously.
+		template<typename Iterator>
+		struct is_standard_contiguous_iterator<Iterator, bool> : std::false_type {};
+
+
+		// Matches if Iterator is not an iterator.
+		template<typename Iterator, typename = std::void_t<>>
+		struct is_contiguous_iterator_impl : std::false_type {};
+
+
+		// Matches if Iterator is an iterator.
+		template<typename Iterator>
+		struct is_contiguous_iterator_impl<Iterator, std::void_t<typename std::iterator_traits<Iterator>::value_type>>
+			: is_standard_contiguous_iterator<Iterator, std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>> {};
+
+
+	}
+
+
+	/* std::true_type if Iterator is known to be a contiguous iterator (ie. the elements it refers to are adjacent in memory, so that
+		*(it + n) is equivalent to *(std::addressof(*it) + n)), otherwise std::false_type.
+		This is the case for pointers, and iterators of std::vector (other than std::vector<bool>), std::basic_string and std::basic_string_view.
+		Since tl::ranges adaptors such as identity_adaptor, const_adaptor and iterator_range expose the iterators of the ranges they adapt, the
+		iterators of such adaptors over contiguous ranges are also detected.
+		May be specialized for other contiguous iterator types. */
+	template<typename Iterator>
+	struct is_contiguous_iterator : std::disjunction<std::is_pointer<Iterator>, detail::is_contiguous_iterator_impl<Iterator>> {};
+
+
+	template<typename Iterator>
+	inline constexpr bool is_contiguous_iterator_v = is_contiguous_iterator<Iterator>::value;
+
+}
+
+
+#endif